@@ -0,0 +1,71 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <SimConnectData.h>
+#include <SimConnectDataDefinition.h>
+#include <SimConnectUpdateRateScheduler.h>
+#include <SimConnectVariableParser.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+int main() {
+  // telemetry capture of 1000 adaptive variables
+  const size_t count = 1000;
+  string parameter;
+  for (size_t kI = 0; kI < count; ++kI) {
+    parameter += "L:TELEMETRY_" + to_string(kI) + ", NUMBER, ADAPTIVE;";
+  }
+  SimConnectDataDefinition::Builder builder;
+  for (const auto &variable : SimConnectVariableParser::getSimConnectVariablesFromParameterString(parameter)) {
+    builder.add(variable);
+  }
+  auto dataDefinition = builder.build();
+  SimConnectData data(dataDefinition);
+  auto group = data.getGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT64>();
+  SimConnectUpdateRateScheduler scheduler((SimConnectUpdateRateScheduler::Configuration()));
+  scheduler.reset(dataDefinition.size());
+
+  // phases of the flight with the number of variables that change, 20 frames per second
+  const double timeStep = 0.05;
+  const size_t framesPerPhase = 2000;
+  const vector<pair<string, size_t>> phases = {{"parked", 0}, {"cruise", 50}, {"maneuver", 500}, {"cruise", 50}};
+  size_t frame = 0;
+  cout << "phase, changing variables, bytes per frame, bytes per frame without adaptive update rates" << endl;
+  for (const auto &[name, changing] : phases) {
+    size_t requestedSize = 0;
+    for (size_t kI = 0; kI < framesPerPhase; ++kI, ++frame) {
+      // bytes requested for the variables that are due in this frame, as done by SimConnectDataInterface
+      const auto &intervals = scheduler.getIntervals();
+      for (size_t kJ = 0; kJ < count; ++kJ) {
+        if (frame % intervals[kJ] == 0) {
+          requestedSize += sizeof(double);
+          double time = static_cast<double>(frame) * timeStep;
+          group[data.getGroupIndex(kJ)] = 1000 + (kJ < changing ? 50 * sin(time + static_cast<double>(kJ)) : 0);
+        }
+      }
+      scheduler.update(dataDefinition, data);
+    }
+    cout << name << ", " << changing << ", " << requestedSize / framesPerPhase << ", " << count * sizeof(double);
+    cout << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <SimConnectData.h>
+#include <SimConnectDataArena.h>
+#include <SimConnectDataDefinition.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+int main() {
+  // definition used by every data object
+  SimConnectDataDefinition::Builder builder;
+  builder.add(SimConnectVariable("PLANE LATITUDE", "DEGREES"));
+  builder.add(SimConnectVariable("PLANE LONGITUDE", "DEGREES"));
+  builder.add(SimConnectVariable("PLANE ALTITUDE", "FEET"));
+  for (int index = 1; index <= 4; ++index) {
+    builder.add(SimConnectVariable("GENERAL ENG RPM:" + to_string(index), "RPM"));
+  }
+  builder.add(SimConnectVariable("SIM ON GROUND", "BOOL"));
+  auto dataDefinition = builder.build();
+
+  // data objects of a model placed into one arena
+  const int count = 100;
+  auto arena = make_shared<SimConnectDataArena>();
+  vector<shared_ptr<SimConnectData>> data;
+  for (int index = 0; index < count; ++index) {
+    data.push_back(make_shared<SimConnectData>(dataDefinition, arena));
+    data.back()->set(2, 1000.0 + index);
+  }
+
+  // snapshot and restore of the whole model state
+  const int snapshots = 10000;
+  vector<char> snapshot;
+  auto start = chrono::steady_clock::now();
+  for (int index = 0; index < snapshots; ++index) {
+    arena->snapshot(snapshot);
+  }
+  auto durationSnapshot = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+  data.front()->set(2, 0.0);
+  arena->restore(snapshot);
+
+  // print result
+  cout << "Data objects: " << count << endl;
+  cout << "Buffer size per data object: " << data.front()->size() << " bytes" << endl;
+  cout << "Arena size: " << arena->size() << " bytes" << endl;
+  cout << "Buffers: " << arena->getBufferCount() << endl;
+  cout << "Allocations with arena: " << arena->getAllocationCount() << endl;
+  cout << "Allocations without arena: " << count << endl;
+  cout << "Snapshot: " << durationSnapshot / snapshots << " us" << endl;
+  cout << "Restored altitude: " << any_cast<double>(data.front()->get(2)) << endl;
+
+  return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <any>
+#include <SimConnectData.h>
+#include <SimConnectDataDefinition.h>
+#include <SimConnectDataInterface.h>
+#include <SimConnectExecutor.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+SimConnectTask monitorAltitude(
+    SimConnectAsyncConnection &connection,
+    const shared_ptr<SimConnectData> &data,
+    size_t monitor,
+    double threshold
+) {
+  // every monitor waits for frames without polling, all monitors share the same request
+  bool isAbove = false;
+  while (co_await connection.nextFrame()) {
+    bool isAboveNow = any_cast<double>(data->get(0)) > threshold;
+    if (isAboveNow != isAbove && monitor % 100 == 0) {
+      cout << "Monitor " << monitor << ": " << (isAboveNow ? "above " : "below ") << threshold << " FEET" << endl;
+    }
+    isAbove = isAboveNow;
+  }
+}
+
+SimConnectTask monitorPause(
+    SimConnectAsyncConnection &connection
+) {
+  // events are awaited the same way as frames
+  while (auto paused = co_await connection.event(SIMCONNECT_SYSTEM_EVENT_PAUSE)) {
+    cout << "Simulation " << (*paused != 0 ? "paused" : "resumed") << endl;
+  }
+}
+
+SimConnectTask toggleLandingLight(
+    SimConnectAsyncConnection &connection,
+    const shared_ptr<SimConnectData> &data
+) {
+  // a write is acknowledged by the next frame
+  for (int count = 0; count < 10; ++count) {
+    for (int frame = 0; frame < 100; ++frame) {
+      if (!co_await connection.nextFrame()) {
+        co_return;
+      }
+    }
+    data->set(1, !any_cast<bool>(data->get(1)));
+    if (!co_await connection.write()) {
+      co_return;
+    }
+    cout << "Landing light: " << any_cast<bool>(data->get(1)) << endl;
+  }
+}
+
+int main() {
+  // data definition defines what to read / write
+  auto dataDefinition = SimConnectDataDefinition();
+  dataDefinition.add(SimConnectVariable("PLANE ALTITUDE", "FEET"));
+  dataDefinition.add(SimConnectVariable("LIGHT LANDING", "BOOL"));
+
+  // create data object holding the actual data
+  auto simConnectData = make_shared<SimConnectData>(dataDefinition);
+
+  // connect to sim
+  SimConnectDataInterface simConnectInterface;
+  bool connected = simConnectInterface.connect(
+      0,
+      "example-coroutine",
+      dataDefinition,
+      simConnectData
+  );
+  cout << connected << endl;
+  if (!connected) {
+    return 1;
+  }
+
+  // thousands of tasks run on this thread, the executor sleeps until SimConnect has messages
+  SimConnectExecutor executor;
+  auto &connection = executor.attach(simConnectInterface);
+  for (size_t monitor = 0; monitor < 1000; ++monitor) {
+    executor.spawn(monitorAltitude(connection, simConnectData, monitor, 1000.0 + 10.0 * static_cast<double>(monitor)));
+  }
+  executor.spawn(monitorPause(connection));
+  executor.spawn(toggleLandingLight(connection, simConnectData));
+
+  // runs until the connection is closed
+  executor.run();
+  cout << "Remaining tasks: " << executor.getTaskCount() << endl;
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include <SimConnectData.h>
+#include <SimConnectDataDefinition.h>
+#include <SimConnectMemoryGuard.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+void printAllocations(
+    const string &name,
+    const SimConnectMemoryGuard &guard
+) {
+  cout << name << ": " << guard.getAllocationCount() << " allocations, " << guard.getAllocatedSize() << " bytes";
+  cout << endl;
+}
+
+int main() {
+  // variables of the definition, names and units are interned before measuring
+  const size_t count = 1000;
+  vector<SimConnectVariable> variables;
+  for (size_t index = 0; index < count; ++index) {
+    variables.emplace_back("GENERAL ENG RPM:" + to_string(index + 1), "RPM");
+  }
+  cout << "Variables: " << count << endl;
+
+  // build definition
+  SimConnectDataDefinition::Builder builder;
+  builder.reserve(count);
+  for (const auto &variable : variables) {
+    builder.add(variable);
+  }
+  auto dataDefinition = builder.build();
+
+  // allocations are measured on the default resource, which the guard replaces while it exists, so everything
+  // allocated from it is released before the guard
+  {
+    SimConnectMemoryGuard guard;
+    SimConnectDataDefinition::Builder guardedBuilder;
+    guardedBuilder.reserve(count);
+    for (const auto &variable : variables) {
+      guardedBuilder.add(variable);
+    }
+    auto guardedDefinition = guardedBuilder.build();
+    printAllocations("Build definition", guard);
+  }
+  {
+    // every add copies the storage, so it is meant for few variables only
+    SimConnectMemoryGuard guard;
+    SimConnectDataDefinition addDefinition;
+    for (size_t index = 0; index < 100; ++index) {
+      addDefinition.add(variables[index]);
+    }
+    printAllocations("Add 100 variables one by one", guard);
+  }
+
+  // a block holds the definition, the data and the connection -> three deep copies before, one shared storage now
+  {
+    SimConnectMemoryGuard guard;
+    for (int copy = 0; copy < 3; ++copy) {
+      pmr::vector<SimConnectVariable> deepCopy(variables.begin(), variables.end());
+    }
+    printAllocations("Three deep copies", guard);
+  }
+  {
+    SimConnectMemoryGuard guard;
+    for (int copy = 0; copy < 3; ++copy) {
+      SimConnectDataDefinition sharedCopy(dataDefinition);
+    }
+    printAllocations("Three shared copies", guard);
+  }
+
+  // copy time of deep copies
+  const int copies = 10000;
+  size_t checksum = 0;
+  auto start = chrono::steady_clock::now();
+  for (int copy = 0; copy < copies; ++copy) {
+    vector<SimConnectVariable> deepCopy(variables);
+    checksum += deepCopy.size();
+  }
+  auto durationDeepCopy = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+
+  // copy time of shared definitions
+  start = chrono::steady_clock::now();
+  for (int copy = 0; copy < copies; ++copy) {
+    SimConnectDataDefinition sharedCopy(dataDefinition);
+    checksum += sharedCopy.size();
+  }
+  auto durationSharedCopy = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+
+  // creating data shares the definition as well
+  SimConnectData data(dataDefinition);
+
+  // print result
+  cout << "Deep copy: " << durationDeepCopy / copies << " us" << endl;
+  cout << "Shared copy: " << durationSharedCopy / copies << " us" << endl;
+  cout << "Data buffer size: " << data.size() << " bytes" << endl;
+  cout << "Checksum: " << checksum << endl;
+
+  // duplicates and aliases are collapsed into one physical variable
+  SimConnectDataDefinition::Builder aliasBuilder;
+  aliasBuilder.add(SimConnectVariable("PLANE ALTITUDE", "FEET"));
+  aliasBuilder.add(SimConnectVariable("plane altitude", "ft"));
+  aliasBuilder.add(SimConnectVariable("PLANE ALTITUDE", "METERS"));
+  aliasBuilder.add(SimConnectVariable("GENERAL ENG RPM:01", "RPM"));
+  aliasBuilder.add(SimConnectVariable("GENERAL ENG RPM : 1", "RPM"));
+  auto aliasDefinition = aliasBuilder.build();
+  cout << "Logical variables: " << aliasDefinition.getLogicalSize() << endl;
+  cout << "Physical variables: " << aliasDefinition.size() << endl;
+
+  return 0;
+}
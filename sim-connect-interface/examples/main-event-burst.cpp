@@ -0,0 +1,72 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <SimConnectEventInterface.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+int main() {
+  // events to transmit
+  vector<SimConnectVariable> events;
+  events.emplace_back("AXIS_ELEVATOR_SET", "AXIS");
+  events.emplace_back("AXIS_AILERONS_SET", "AXIS");
+  events.emplace_back("TOGGLE_NAV_LIGHTS", "TRIGGER");
+
+  // connect to sim
+  SimConnectEventInterface simConnectInterface;
+  bool connected = simConnectInterface.connect(
+      0,
+      "example-event-burst",
+      events
+  );
+  cout << connected << endl;
+  if (!connected) {
+    return 1;
+  }
+
+  // burst of steps with several axis updates per step, only the latest one per step is transmitted
+  const int steps = 10000;
+  const int updatesPerStep = 10;
+  auto start = chrono::steady_clock::now();
+  for (int step = 0; step < steps; ++step) {
+    for (int update = 0; update < updatesPerStep; ++update) {
+      double value = ((step * updatesPerStep + update) % 200) / 100.0 - 1.0;
+      simConnectInterface.set(0, value);
+      simConnectInterface.set(1, -value);
+    }
+    simConnectInterface.set(2, step % 100 == 0 ? 1.0 : 0.0);
+    if (!simConnectInterface.sendData()) {
+      cout << "Failed transmitting" << endl;
+    }
+    simConnectInterface.readData();
+  }
+  auto duration = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  // print result
+  cout << "Steps: " << steps << endl;
+  cout << "Updates: " << steps * (2 * updatesPerStep + 1) << endl;
+  cout << "Transmitted events: " << simConnectInterface.getTransmitCount() << endl;
+  cout << "Duration: " << duration << " s" << endl;
+  cout << "Throughput: " << static_cast<double>(simConnectInterface.getTransmitCount()) / duration << " events/s" << endl;
+
+  simConnectInterface.disconnect();
+
+  return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <SimConnectDataFilter.h>
+#include <SimConnectVariableParser.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+int main() {
+  // the filters of a block are configured in the variable syntax
+  auto variables = SimConnectVariableParser::getSimConnectVariablesFromParameterString(
+      "PLANE ALTITUDE, FEET, FILTER=LOWPASS:0.5;"
+      "PLANE ALTITUDE, FEET, FILTER=LOWPASS2:0.5;"
+      "PLANE ALTITUDE, FEET, FILTER=AVERAGE:10;"
+      "PLANE ALTITUDE, FEET, FILTER=DERIVATIVE;"
+  );
+  SimConnectDataFilter filter;
+  for (const auto &variable : variables) {
+    filter.add(0, SimConnectUnitConversion(), variable.filter, variable.filterParameter);
+  }
+
+  // step from 0 to 100 feet after the first frame at 20 frames per second
+  const double timeStep = 0.05;
+  double altitude = 0;
+  vector<double> filtered(filter.size());
+  cout << "time, lowpass, lowpass2, average, derivative" << endl;
+  for (int frame = 0; frame <= 20; ++frame) {
+    filter.process(&altitude, filtered.data(), timeStep);
+    cout << frame * timeStep << ", " << filtered[0] << ", " << filtered[1] << ", " << filtered[2] << ", ";
+    cout << filtered[3] << endl;
+    altitude = 100;
+  }
+
+  // batch of filters over a 64-bit floating point group
+  const size_t count = 1000;
+  vector<double> group(count, 0);
+  SimConnectDataFilter bank;
+  for (size_t kI = 0; kI < count; ++kI) {
+    auto type = static_cast<SIMCONNECT_VARIABLE_FILTER>(SIMCONNECT_VARIABLE_FILTER_LOWPASS + kI % 4);
+    bank.add(kI, SimConnectUnitConversion(), type, type == SIMCONNECT_VARIABLE_FILTER_AVERAGE ? 10 : 0.5);
+  }
+  vector<double> output(bank.size());
+  const int rounds = 100000;
+  auto start = chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    group[round % count] += 1;
+    bank.process(group.data(), output.data(), timeStep);
+  }
+  auto duration = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+
+  // print result
+  cout << "Filter: " << duration / rounds / count << " ns (" << output[0] << ")" << endl;
+
+  return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <SimConnectData.h>
+#include <SimConnectDataHash.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+int main() {
+  // frames of 1 KB to 100 KB of 64-bit floating point variables
+  for (size_t frameSize : {1024, 10 * 1024, 100 * 1024}) {
+    SimConnectDataDefinition::Builder builder;
+    for (size_t kI = 0; kI < frameSize / sizeof(double); ++kI) {
+      builder.add(SimConnectVariable("L:HASH_" + to_string(kI), "NUMBER"));
+    }
+    auto definition = builder.build();
+    SimConnectData data(definition);
+    vector<char> frame(data.size(), 0);
+    const int rounds = static_cast<int>(100000000 / frameSize);
+
+    // hash only
+    uint64_t hash = 0;
+    auto start = chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+      frame[round % frame.size()]++;
+      hash ^= SimConnectDataHash::hash(frame.data(), frame.size());
+    }
+    auto durationHash = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / rounds;
+
+    // receiving changed frames
+    start = chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+      frame[round % frame.size()]++;
+      data.copy(frame.data());
+    }
+    auto durationChanged = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / rounds;
+
+    // receiving identical frames
+    size_t unchangedCount = 0;
+    start = chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+      data.copy(frame.data());
+      unchangedCount += data.isUnchanged() ? 1 : 0;
+    }
+    auto durationUnchanged = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / rounds;
+
+    // print result
+    cout << "Frame size: " << data.size() << " bytes (hash " << hash << ")" << endl;
+    cout << "  Hash: " << durationHash << " ns (" << data.size() / durationHash << " GB/s)" << endl;
+    cout << "  Changed frame: " << durationChanged << " ns" << endl;
+    cout << "  Unchanged frame: " << durationUnchanged << " ns (" << unchangedCount << " of " << rounds << ")" << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <SimConnectData.h>
+#include <SimConnectDataLayout.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+double measureBulkExport(
+    SimConnectData &data,
+    size_t count
+) {
+  // copy the float64 group into an array of doubles
+  vector<double> values(count);
+  const int iterations = 1000000;
+  auto *source = data.getBuffer() + data.getOffset(SIMCONNECT_VARIABLE_TYPE_FLOAT64);
+  double checksum = 0;
+  auto start = chrono::steady_clock::now();
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    memcpy(values.data(), source, count * sizeof(double));
+    checksum += values[iteration % count];
+  }
+  auto duration = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+  cout << "  checksum: " << checksum << endl;
+  return duration / iterations;
+}
+
+double measureContention(
+    SimConnectData &data,
+    size_t count
+) {
+  // one thread keeps writing the boolean group while another one reads the float64 group
+  atomic<bool> isRunning = true;
+  auto *flags = reinterpret_cast<volatile int *>(data.getBuffer() + data.getOffset(SIMCONNECT_VARIABLE_TYPE_BOOL));
+  auto *values = reinterpret_cast<volatile double *>(data.getBuffer() + data.getOffset(SIMCONNECT_VARIABLE_TYPE_FLOAT64));
+  thread writer([&]() {
+    int value = 0;
+    while (isRunning) {
+      flags[0] = ++value;
+    }
+  });
+
+  // count read passes within a fixed time
+  unsigned long long passes = 0;
+  double checksum = 0;
+  auto duration = chrono::milliseconds(500);
+  auto start = chrono::steady_clock::now();
+  while (chrono::steady_clock::now() - start < duration) {
+    for (int repeat = 0; repeat < 100; ++repeat) {
+      for (size_t index = 0; index < count; ++index) {
+        checksum += values[index];
+      }
+    }
+    passes += 100;
+  }
+  isRunning = false;
+  writer.join();
+  cout << "  checksum: " << checksum << endl;
+  return static_cast<double>(passes) / chrono::duration<double>(duration).count();
+}
+
+int main() {
+  // definition with a few flags and many float64 values
+  const size_t countFloat64 = 30;
+  SimConnectDataDefinition::Builder builder;
+  builder.add(SimConnectVariable("AUTOPILOT PITCH HOLD", "BOOL"));
+  builder.add(SimConnectVariable("HOLDBACK BAR INSTALLED", "BOOL"));
+  builder.add(SimConnectVariable("RECIP ENG FUEL TANK SELECTOR:1", "ENUM"));
+  for (size_t index = 1; index <= countFloat64; ++index) {
+    builder.add(SimConnectVariable("GENERAL ENG RPM:" + to_string(index), "RPM"));
+  }
+  auto dataDefinition = builder.build();
+
+  // packed layout against cache line aligned layout with hot float64 values first
+  SimConnectData packed(dataDefinition);
+  SimConnectData aligned(
+      dataDefinition,
+      nullptr,
+      SimConnectDataLayout::getCacheLineAligned(
+          {
+              SIMCONNECT_VARIABLE_TYPE_FLOAT64,
+              SIMCONNECT_VARIABLE_TYPE_FLOAT32,
+              SIMCONNECT_VARIABLE_TYPE_INT32,
+              SIMCONNECT_VARIABLE_TYPE_BOOL,
+              SIMCONNECT_VARIABLE_TYPE_LATLONALT,
+              SIMCONNECT_VARIABLE_TYPE_XYZ,
+          }
+      )
+  );
+
+  for (auto *data : {&packed, &aligned}) {
+    auto address = reinterpret_cast<uintptr_t>(data->getBuffer() + data->getOffset(SIMCONNECT_VARIABLE_TYPE_FLOAT64));
+    cout << (data == &packed ? "Packed layout" : "Aligned layout") << endl;
+    cout << "  size: " << data->size() << " bytes" << endl;
+    cout << "  float64 group alignment: " << (address % 64 == 0 ? 64 : address % 64) << endl;
+    cout << "  bulk export: " << measureBulkExport(*data, countFloat64) << " ns" << endl;
+    cout << "  reads with concurrent writer: " << measureContention(*data, countFloat64) << " passes/s" << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <SimConnectDataInterface.h>
+#include <SimConnectLockstep.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+int main() {
+  // create data definition
+  SimConnectDataDefinition dataDefinition;
+  dataDefinition.add(SimConnectVariable("SIMULATION TIME", "SECONDS"));
+  dataDefinition.add(SimConnectVariable("PLANE ALTITUDE", "FEET"));
+  dataDefinition.add(SimConnectVariable("AIRSPEED TRUE", "KNOTS"));
+  auto data = make_shared<SimConnectData>(dataDefinition);
+
+  // connect to sim
+  auto dataInterface = make_shared<SimConnectDataInterface>();
+  SimConnectLockstep lockstep;
+  bool connected = dataInterface->connect(
+      0,
+      "example-lockstep",
+      dataDefinition,
+      data
+  ) && lockstep.connect(
+      0,
+      "example-lockstep-control",
+      dataInterface
+  );
+  cout << connected << endl;
+  if (!connected) {
+    return 1;
+  }
+
+  // run a controller that is slower than real time in lockstep with the sim
+  if (!lockstep.start()) {
+    cout << "Failed to pause the sim" << endl;
+    return 1;
+  }
+  const int steps = 500;
+  for (int step = 0; step < steps; ++step) {
+    // read state
+    dataInterface->requestReadData();
+    // heavy computation
+    this_thread::sleep_for(chrono::milliseconds(50));
+    // advance the sim
+    if (!lockstep.advance()) {
+      cout << "Failed to advance the sim" << endl;
+      break;
+    }
+    if (step % 50 == 0) {
+      cout << "Simulation time: " << any_cast<double>(data->get(0)) << " s" << endl;
+    }
+  }
+
+  // print result
+  cout << "Steps: " << lockstep.getStepCount() << endl;
+  cout << "Frames: " << lockstep.getFrameCount() << endl;
+  cout << "Throughput: " << lockstep.getFramesPerSecond() << " frames/s" << endl;
+
+  lockstep.disconnect();
+  dataInterface->disconnect();
+
+  return 0;
+}
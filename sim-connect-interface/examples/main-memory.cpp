@@ -0,0 +1,114 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <array>
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <SimConnectData.h>
+#include <SimConnectDataArena.h>
+#include <SimConnectDataDefinition.h>
+#include <SimConnectDataInterface.h>
+#include <SimConnectMemoryGuard.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+// allocations with the global operator new are recorded by the guard as well
+void *operator new(
+    size_t bytes
+) {
+  SimConnectMemoryGuard::recordGlobalAllocation(bytes);
+  if (void *p = malloc(bytes == 0 ? 1 : bytes)) {
+    return p;
+  }
+  throw bad_alloc();
+}
+
+void operator delete(
+    void *p
+) noexcept {
+  free(p);
+}
+
+void operator delete(
+    void *p,
+    size_t
+) noexcept {
+  free(p);
+}
+
+int main() {
+  // all memory is taken from a fixed buffer, there is no fallback to the heap
+  static array<char, 256 * 1024> memory;
+  pmr::monotonic_buffer_resource resource(memory.data(), memory.size(), pmr::null_memory_resource());
+
+  // initialize
+  SimConnectDataDefinition::Builder builder(&resource);
+  builder.add(SimConnectVariable("PLANE LATITUDE", "DEGREES"));
+  builder.add(SimConnectVariable("PLANE LONGITUDE", "DEGREES"));
+  builder.add(SimConnectVariable("PLANE ALTITUDE", "FEET"));
+  builder.add(SimConnectVariable("SIM ON GROUND", "BOOL"));
+  auto dataDefinition = builder.build();
+  auto arena = allocate_shared<SimConnectDataArena>(
+      pmr::polymorphic_allocator<SimConnectDataArena>(&resource),
+      SimConnectDataArena::DEFAULT_BLOCK_SIZE,
+      &resource
+  );
+  auto data = allocate_shared<SimConnectData>(
+      pmr::polymorphic_allocator<SimConnectData>(&resource),
+      dataDefinition,
+      arena,
+      SimConnectDataLayout(),
+      &resource
+  );
+  SimConnectDataInterface simConnectInterface(&resource);
+  bool connected = simConnectInterface.connect(
+      0,
+      "example-memory",
+      dataDefinition,
+      data
+  );
+  cout << connected << endl;
+
+  // steady state stepping must neither touch the default resource nor the heap
+  const int steps = 1000;
+  unsigned long long allocationCount;
+  size_t allocatedSize;
+  {
+    SimConnectMemoryGuard guard;
+    for (int step = 0; step < steps; ++step) {
+      if (connected) {
+        simConnectInterface.requestReadData();
+      }
+      data->set(2, any_cast<double>(data->get(2)) + 1.0);
+    }
+    allocationCount = guard.getAllocationCount();
+    allocatedSize = guard.getAllocatedSize();
+  }
+
+  // print result
+  cout << "Steps: " << steps << endl;
+  cout << "Default resource and heap allocations: " << allocationCount << endl;
+  cout << "Default resource and heap bytes: " << allocatedSize << endl;
+  cout << "Result: " << (allocationCount == 0 ? "passed" : "failed") << endl;
+
+  simConnectInterface.disconnect();
+
+  return allocationCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <SimConnectData.h>
+#include <SimConnectDataObserver.h>
+#include <SimConnectVariableParser.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+int main() {
+  // triggers are configured through the variable syntax
+  auto variables = SimConnectVariableParser::getSimConnectVariablesFromParameterString(
+      "GEAR HANDLE POSITION, BOOL, TRIGGER=CHANGED;"
+      "STALL WARNING, BOOL, TRIGGER=CHANGED;"
+      "PLANE ALTITUDE, FEET, TRIGGER=CROSSED:10000;"
+      "AIRSPEED INDICATED, KNOTS, TRIGGER=DEADBAND:5;"
+  );
+  auto definition = SimConnectVariableParser::getSimConnectDataDefinitionFromVariables(variables);
+  SimConnectData data(definition);
+
+  // only callbacks of fired triggers are invoked
+  SimConnectDataObserver observer;
+  for (size_t index = 0; index < definition.size(); ++index) {
+    const auto &variable = definition.getLogical(index);
+    observer.add(
+        definition,
+        definition.getPhysicalIndex(index),
+        variable.trigger,
+        variable.triggerThreshold,
+        [&variable](size_t, double value) {
+          cout << "  " << variable.name << ": " << value << endl;
+        }
+    );
+  }
+
+  // a short flight
+  const double altitudes[] = {9800, 9950, 10050, 10100, 9990};
+  const double speeds[] = {250, 252, 256, 258, 262};
+  for (size_t frame = 0; frame < 5; ++frame) {
+    data.set(0, frame >= 3);
+    data.set(1, frame == 4);
+    data.set(2, altitudes[frame]);
+    data.set(3, speeds[frame]);
+    cout << "Frame " << frame << ":" << endl;
+    observer.evaluate(data);
+  }
+
+  // many triggers on one frame
+  const size_t count = 10000;
+  SimConnectDataDefinition::Builder builder;
+  builder.reserve(count);
+  for (size_t index = 0; index < count; ++index) {
+    builder.add(SimConnectVariable("L:OBSERVED_" + to_string(index), "NUMBER"));
+  }
+  auto largeDefinition = builder.build();
+  SimConnectData largeData(largeDefinition);
+  SimConnectDataObserver largeObserver;
+  for (size_t index = 0; index < count; ++index) {
+    largeObserver.add(largeDefinition, index, SIMCONNECT_VARIABLE_TRIGGER_DEADBAND, 1.0);
+  }
+
+  // measure evaluation
+  const int rounds = 1000;
+  size_t firedCount = 0;
+  auto group = largeData.getGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT64>();
+  auto start = chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    group[round % count] = static_cast<double>(round);
+    firedCount += largeObserver.evaluate(largeData);
+  }
+  auto duration = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+
+  // print result
+  cout << "Evaluation: " << duration / (rounds * count) << " ns per trigger" << endl;
+  cout << "Fired: " << firedCount << endl;
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <SimConnectVariableLookupTable.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+double getLookupTime(
+    const vector<SimConnectVariable> &variables,
+    size_t &checksum
+) {
+  // resolve every name once, then measure the cached lookup
+  for (const auto &variable : variables) {
+    checksum += SimConnectVariableLookupTable::getDataType(variable);
+  }
+  const int rounds = 1000;
+  auto start = chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    for (const auto &variable : variables) {
+      checksum += SimConnectVariableLookupTable::getDataType(variable);
+    }
+  }
+  auto duration = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+  return duration / (rounds * variables.size());
+}
+
+int main(
+    int argc,
+    char *argv[]
+) {
+  // optionally load a user registry file
+  if (argc > 1 && !SimConnectVariableLookupTable::loadRegistryFile(argv[1])) {
+    cout << "Failed to load variable registry '" << argv[1] << "'" << endl;
+    return 1;
+  }
+
+  // built-in variables
+  vector<SimConnectVariable> builtInVariables;
+  for (const auto &name : {"PLANE ALTITUDE", "PLANE LATITUDE", "PLANE LONGITUDE", "AIRSPEED INDICATED",
+                           "LIGHT STROBE ON", "STRUCT LATLONALT", "NUMBER OF ENGINES"}) {
+    builtInVariables.emplace_back(name, "NUMBER");
+  }
+  for (int index = 1; index <= 4; ++index) {
+    builtInVariables.emplace_back("GENERAL ENG RPM:" + to_string(index), "RPM");
+  }
+
+  // measure lookup of built-in variables with an empty user registry
+  size_t checksum = 0;
+  double builtInTime = getLookupTime(builtInVariables, checksum);
+
+  // register many user variables
+  const int count = 10000;
+  vector<SimConnectVariable> userVariables;
+  for (int index = 0; index < count; ++index) {
+    string name = "CUSTOM VARIABLE " + to_string(index);
+    SimConnectVariableLookupTable::registerVariable(name, SIMCONNECT_VARIABLE_TYPE_FLOAT64);
+    if (index % 100 == 0) {
+      userVariables.emplace_back(name, "NUMBER");
+    }
+  }
+
+  // measure lookup of built-in variables again, then user, local and overridden variables
+  double builtInRegistryTime = getLookupTime(builtInVariables, checksum);
+  double userTime = getLookupTime(userVariables, checksum);
+  vector<SimConnectVariable> localVariables;
+  for (int index = 0; index < 10; ++index) {
+    localVariables.emplace_back("L:A32NX_VARIABLE_" + to_string(index), "NUMBER");
+  }
+  double localTime = getLookupTime(localVariables, checksum);
+  vector<SimConnectVariable> overriddenVariables = builtInVariables;
+  for (auto &variable : overriddenVariables) {
+    variable.type = SIMCONNECT_VARIABLE_TYPE_FLOAT32;
+  }
+  double overrideTime = getLookupTime(overriddenVariables, checksum);
+
+  // print result
+  cout << "Built-in lookup: " << builtInTime << " ns" << endl;
+  cout << "Built-in lookup with " << count << " registered variables: " << builtInRegistryTime << " ns" << endl;
+  cout << "Registered lookup: " << userTime << " ns" << endl;
+  cout << "Local variable lookup: " << localTime << " ns" << endl;
+  cout << "Type override lookup: " << overrideTime << " ns" << endl;
+  cout << "Checksum: " << checksum << endl;
+
+  return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <SimConnectData.h>
+#include <SimConnectVariableParser.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+int main() {
+  // strings are stored inline in slots of fixed capacity
+  auto definition = SimConnectVariableParser::getSimConnectDataDefinitionFromVariables(
+      SimConnectVariableParser::getSimConnectVariablesFromParameterString(
+          "PLANE ALTITUDE, FEET;"
+          "TITLE, STRING;"
+          "ATC ID, STRING;"
+          "ATC FLIGHT NUMBER, STRING;"
+      )
+  );
+  SimConnectData data(definition);
+  cout << "Buffer size: " << data.size() << " bytes" << endl;
+
+  // reading a string is a view on the buffer
+  uint64_t titleHash = data.getStringHash(1);
+  data.setString(1, "Airbus A320 Neo");
+  data.setString(2, "D-AXLA");
+  data.setString(3, "DLH12345");
+  cout << "TITLE: " << data.getString(1) << endl;
+  cout << "ATC ID: " << data.getString(2) << endl;
+  cout << "ATC FLIGHT NUMBER: " << data.getString(3) << " (truncated to the capacity)" << endl;
+  cout << "TITLE changed: " << data.hasStringChanged(1, titleHash) << endl;
+  cout << "TITLE changed again: " << data.hasStringChanged(1, titleHash) << endl;
+
+  // frames received from SimConnect update the hashes, consumers only compare them
+  vector<char> frame(data.getBuffer(), data.getBuffer() + data.size());
+  const int rounds = 100000;
+  size_t changes = 0;
+  auto start = chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    data.copy(frame.data());
+    if (data.hasStringChanged(1, titleHash)) {
+      changes++;
+    }
+  }
+  auto duration = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+
+  // print result
+  cout << "Frame with change detection: " << duration / rounds << " ns" << endl;
+  cout << "Changes: " << changes << endl;
+
+  return 0;
+}
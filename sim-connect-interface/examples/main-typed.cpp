@@ -0,0 +1,71 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <SimConnectTypedDefinition.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+// variables with their C++ types, checked against the lookup table at compile time
+SIMCONNECT_TYPED_VARIABLE(PlaneLatitude, "PLANE LATITUDE", "DEGREES", double);
+SIMCONNECT_TYPED_VARIABLE(PlaneLongitude, "PLANE LONGITUDE", "DEGREES", double);
+SIMCONNECT_TYPED_VARIABLE(PlaneAltitude, "PLANE ALTITUDE", "FEET", double);
+SIMCONNECT_TYPED_VARIABLE(SimOnGround, "SIM ON GROUND", "BOOL", int32_t);
+SIMCONNECT_TYPED_VARIABLE(GeneralEngineRpm1, "GENERAL ENG RPM:1", "RPM", double);
+
+using AircraftDefinition = SimConnectTypedDefinition<
+    PlaneLatitude,
+    PlaneLongitude,
+    PlaneAltitude,
+    SimOnGround,
+    GeneralEngineRpm1
+>;
+
+static_assert(AircraftDefinition::size == 4 * sizeof(double) + sizeof(int32_t));
+static_assert(AircraftDefinition::offsetOf<SimOnGround>() == 3 * sizeof(double));
+
+int main() {
+  // connect to sim
+  SimConnectTypedDataInterface<AircraftDefinition> simConnectInterface;
+  bool connected = simConnectInterface.connect(
+      0,
+      "example-typed"
+  );
+  cout << connected << endl;
+  if (!connected) {
+    return 1;
+  }
+
+  // loop and print values without any runtime type resolution
+  while (true) {
+    simConnectInterface.requestReadData();
+    const auto &frame = simConnectInterface.getFrame();
+    cout << "Frame: " << simConnectInterface.getFrameCount() << endl;
+    cout << "  PLANE LATITUDE: " << frame.get<PlaneLatitude>() << endl;
+    cout << "  PLANE LONGITUDE: " << frame.get<PlaneLongitude>() << endl;
+    cout << "  PLANE ALTITUDE: " << frame.get<PlaneAltitude>() << endl;
+    cout << "  SIM ON GROUND: " << (frame.get<SimOnGround>() != 0) << endl;
+    cout << "  GENERAL ENG RPM:1: " << frame.get<GeneralEngineRpm1>() << endl;
+    this_thread::sleep_for(chrono::milliseconds(100));
+  }
+
+  simConnectInterface.disconnect();
+
+  return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <SimConnectUnit.h>
+#include <SimConnectUnitConverter.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+int main() {
+  // units are validated and converted at compile time
+  static_assert(SimConnectUnit::isKnown("FEET"));
+  static_assert(!SimConnectUnit::isKnown("FEETS"));
+  static_assert(SimConnectUnit::isConvertible("FEET", "METERS"));
+  static_assert(!SimConnectUnit::isConvertible("FEET", "KNOTS"));
+  constexpr auto feetToMeters = SimConnectUnit::getConversion("FEET", "METERS");
+  constexpr auto celsiusToFahrenheit = SimConnectUnit::getConversion("CELSIUS", "FAHRENHEIT");
+
+  cout << "10000 FEET = " << 10000 * feetToMeters.scale + feetToMeters.offset << " METERS" << endl;
+  cout << "15 CELSIUS = " << 15 * celsiusToFahrenheit.scale + celsiusToFahrenheit.offset << " FAHRENHEIT" << endl;
+
+  // one batch converting every value into a second unit
+  const size_t count = 10000;
+  vector<double> source(count);
+  vector<double> target(count);
+  SimConnectUnitConverter converter;
+  for (size_t index = 0; index < count; ++index) {
+    source[index] = static_cast<double>(index);
+    converter.add(index, index % 2 == 0 ? feetToMeters : celsiusToFahrenheit);
+  }
+
+  // measure conversion
+  const int rounds = 1000;
+  double checksum = 0;
+  auto start = chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    converter.convert(source.data(), target.data());
+    checksum += target[round % count];
+  }
+  auto duration = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+
+  // print result
+  cout << "Conversion: " << duration / (rounds * count) << " ns per value" << endl;
+  cout << "Checksum: " << checksum << endl;
+
+  return 0;
+}
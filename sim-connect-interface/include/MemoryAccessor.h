@@ -22,6 +22,8 @@
 template<class T>
 class MemoryAccessor {
  public:
+  MemoryAccessor() = default;
+
   MemoryAccessor(
       char *_data,
       size_t _count
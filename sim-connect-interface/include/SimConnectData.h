@@ -17,28 +17,103 @@
 #pragma once
 
 #include <any>
-#include <deque>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include <memory_resource>
 #include <Windows.h>
 #include <SimConnect.h>
 #include "MemoryAccessor.h"
+#include "SimConnectDataArena.h"
 #include "SimConnectDataDefinition.h"
+#include "SimConnectDataLayout.h"
+#include "SimConnectSpan.h"
 
 namespace simconnect::toolbox::connection {
+
+// element type of the type groups in the data buffer
+template<SIMCONNECT_VARIABLE_TYPE Type>
+struct SimConnectDataGroup;
+
+template<>
+struct SimConnectDataGroup<SIMCONNECT_VARIABLE_TYPE_BOOL> {
+  using type = int;
+};
+
+template<>
+struct SimConnectDataGroup<SIMCONNECT_VARIABLE_TYPE_INT32> {
+  using type = long;
+};
+
+template<>
+struct SimConnectDataGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT32> {
+  using type = float;
+};
+
+template<>
+struct SimConnectDataGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT64> {
+  using type = double;
+};
+
+template<>
+struct SimConnectDataGroup<SIMCONNECT_VARIABLE_TYPE_LATLONALT> {
+  using type = SIMCONNECT_DATA_LATLONALT;
+};
+
+template<>
+struct SimConnectDataGroup<SIMCONNECT_VARIABLE_TYPE_XYZ> {
+  using type = SIMCONNECT_DATA_XYZ;
+};
+
 class SimConnectData;
 }
 
 class simconnect::toolbox::connection::SimConnectData {
  public:
   explicit SimConnectData(
-      const SimConnectDataDefinition &dataDefinition
+      const SimConnectDataDefinition &dataDefinition,
+      const std::shared_ptr<SimConnectDataArena> &arena = nullptr,
+      const SimConnectDataLayout &layout = SimConnectDataLayout(),
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource()
   );
 
   ~SimConnectData();
 
+  [[nodiscard]] const SimConnectDataLayout &getLayout() const;
+
   [[nodiscard]] size_t size() const;
 
   char *getBuffer();
 
+  [[nodiscard]] size_t getOffset(
+      SIMCONNECT_VARIABLE_TYPE type
+  ) const;
+
+  size_t getVariableOffset(
+      size_t index
+  );
+
+  [[nodiscard]] size_t getGroupIndex(
+      size_t index
+  ) const;
+
+  template<SIMCONNECT_VARIABLE_TYPE Type>
+  SimConnectSpan<typename SimConnectDataGroup<Type>::type> getGroup() {
+    // view on all variables of a type, the order is the order of the data definition
+    return {
+        reinterpret_cast<typename SimConnectDataGroup<Type>::type *>(buffer + getOffset(Type)),
+        dataDefinition.getTypeCount(Type)
+    };
+  }
+
+  template<SIMCONNECT_VARIABLE_TYPE Type>
+  SimConnectSpan<const typename SimConnectDataGroup<Type>::type> getGroup() const {
+    return {
+        reinterpret_cast<const typename SimConnectDataGroup<Type>::type *>(buffer + getOffset(Type)),
+        dataDefinition.getTypeCount(Type)
+    };
+  }
+
   std::any get(
       size_t index
   );
@@ -48,10 +123,38 @@ class simconnect::toolbox::connection::SimConnectData {
       std::any value
   );
 
+  [[nodiscard]] std::string_view getString(
+      size_t index
+  ) const;
+
+  void setString(
+      size_t index,
+      std::string_view value
+  );
+
+  [[nodiscard]] uint64_t getStringHash(
+      size_t index
+  ) const;
+
+  bool hasStringChanged(
+      size_t index,
+      uint64_t &hash
+  ) const;
+
   void copy(
       char *pBuffer
   );
 
+  // hash of the data received last, values changed by set are not included
+  [[nodiscard]] uint64_t getContentHash() const;
+
+  // true if the data received last is identical to the data received before
+  [[nodiscard]] bool isUnchanged() const;
+
+  void carryOver(
+      SimConnectData &previous
+  );
+
  private:
   struct MemberCount {
     size_t countBoolean = 0;
@@ -60,29 +163,66 @@ class simconnect::toolbox::connection::SimConnectData {
     size_t countFloat64 = 0;
     size_t countLatLonAlt = 0;
     size_t countXYZ = 0;
+    size_t countString8 = 0;
+    size_t countString32 = 0;
+    size_t countString64 = 0;
+    size_t countString256 = 0;
+  };
+
+  struct MemberOffset {
+    size_t offsetBoolean = 0;
+    size_t offsetInt32 = 0;
+    size_t offsetFloat32 = 0;
+    size_t offsetFloat64 = 0;
+    size_t offsetLatLonAlt = 0;
+    size_t offsetXYZ = 0;
+    size_t offsetString8 = 0;
+    size_t offsetString32 = 0;
+    size_t offsetString64 = 0;
+    size_t offsetString256 = 0;
   };
 
   SimConnectDataDefinition dataDefinition;
-  std::deque<size_t> indexMapping;
   MemberCount memberCount = {};
+  MemberOffset memberOffset = {};
+  SimConnectDataLayout dataLayout;
 
   size_t totalSize = 0;
   char *buffer = nullptr;
-
-  std::shared_ptr<MemoryAccessor<int>> memoryAccessorBoolean = nullptr;
-  std::shared_ptr<MemoryAccessor<long>> memoryAccessorInt32 = nullptr;
-  std::shared_ptr<MemoryAccessor<float>> memoryAccessorFloat32 = nullptr;
-  std::shared_ptr<MemoryAccessor<double>> memoryAccessorFloat64 = nullptr;
-  std::shared_ptr<MemoryAccessor<SIMCONNECT_DATA_LATLONALT>> memoryAccessorLatLonAlt = nullptr;
-  std::shared_ptr<MemoryAccessor<SIMCONNECT_DATA_XYZ>> memoryAccessorXYZ = nullptr;
-
-  MemberCount getMemberCountFromDataDefinition(
-      SimConnectDataDefinition _dataDefinition
+  char *allocation = nullptr;
+  size_t allocationAlignment = 0;
+  std::pmr::memory_resource *memoryResource = nullptr;
+  std::shared_ptr<SimConnectDataArena> dataArena;
+  std::pmr::vector<uint64_t> stringHashes;
+  uint64_t contentHash = 0;
+  bool isContentUnchanged = false;
+
+  MemoryAccessor<int> memoryAccessorBoolean;
+  MemoryAccessor<long> memoryAccessorInt32;
+  MemoryAccessor<float> memoryAccessorFloat32;
+  MemoryAccessor<double> memoryAccessorFloat64;
+  MemoryAccessor<SIMCONNECT_DATA_LATLONALT> memoryAccessorLatLonAlt;
+  MemoryAccessor<SIMCONNECT_DATA_XYZ> memoryAccessorXYZ;
+
+  static MemberCount getMemberCountFromDataDefinition(
+      const SimConnectDataDefinition &_dataDefinition
   );
 
-  static size_t getTotalSize(
-      MemberCount counts
+  static size_t getMemberOffsets(
+      const MemberCount &counts,
+      const SimConnectDataLayout &layout,
+      MemberOffset &offsets
   );
 
   void setupMemoryAccessors();
+
+  [[nodiscard]] size_t getStringSlot(
+      size_t index
+  ) const;
+
+  void updateStringHashes();
+
+  static uint64_t hashString(
+      std::string_view value
+  );
 };
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace simconnect::toolbox::connection {
+class SimConnectDataArena;
+}
+
+class simconnect::toolbox::connection::SimConnectDataArena {
+ public:
+  explicit SimConnectDataArena(
+      size_t blockSize = DEFAULT_BLOCK_SIZE,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+  );
+
+  ~SimConnectDataArena();
+
+  SimConnectDataArena(
+      SimConnectDataArena const &
+  ) = delete;
+
+  void operator=(
+      SimConnectDataArena const &
+  ) = delete;
+
+  static std::shared_ptr<SimConnectDataArena> get(
+      const std::string &name
+  );
+
+  char *allocate(
+      size_t size
+  );
+
+  void deallocate(
+      char *buffer,
+      size_t size
+  );
+
+  [[nodiscard]] size_t size() const;
+
+  [[nodiscard]] size_t getAllocationCount() const;
+
+  [[nodiscard]] size_t getBufferCount() const;
+
+  void snapshot(
+      std::vector<char> &target
+  ) const;
+
+  bool restore(
+      const std::vector<char> &source
+  );
+
+  inline const static size_t CACHE_LINE_SIZE = 64;
+  inline const static size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+ private:
+  struct Block {
+    char *data = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+  };
+
+  mutable std::mutex mutex;
+  size_t blockSize;
+  std::pmr::memory_resource *memoryResource;
+  std::pmr::vector<Block> blocks;
+  std::pmr::map<char *, size_t> freeSlots;
+  size_t bufferCount = 0;
+
+  inline static std::mutex registryMutex;
+  inline static std::map<std::string, std::weak_ptr<SimConnectDataArena>> registry;
+
+  void forEachBuffer(
+      const std::function<void(char *, size_t)> &function
+  ) const;
+
+  static size_t align(
+      size_t size
+  );
+};
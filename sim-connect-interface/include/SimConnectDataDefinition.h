@@ -16,10 +16,14 @@
 
 #pragma once
 
-#include <deque>
+#include <array>
 #include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
 #include <Windows.h>
 #include <SimConnect.h>
+#include "SimConnectUnit.h"
 #include "SimConnectVariable.h"
 #include "SimConnectVariableLookupTable.h"
 
@@ -28,37 +32,187 @@ class SimConnectDataDefinition;
 }
 
 class simconnect::toolbox::connection::SimConnectDataDefinition {
+ private:
+  struct Storage {
+    explicit Storage(
+        std::pmr::memory_resource *resource
+    ) : variables(resource), types(resource), typeIndices(resource),
+        logicalVariables(resource), physicalIndices(resource), conversions(resource), physicalIndexByName(resource) {
+    }
+
+    Storage(
+        const Storage &other
+    ) : variables(other.variables, other.variables.get_allocator()),
+        types(other.types, other.types.get_allocator()),
+        typeIndices(other.typeIndices, other.typeIndices.get_allocator()),
+        typeCounts(other.typeCounts),
+        logicalVariables(other.logicalVariables, other.logicalVariables.get_allocator()),
+        physicalIndices(other.physicalIndices, other.physicalIndices.get_allocator()),
+        conversions(other.conversions, other.conversions.get_allocator()),
+        physicalIndexByName(other.physicalIndexByName, other.physicalIndexByName.get_allocator()) {
+    }
+
+    // physical variables as registered in SimConnect
+    std::pmr::vector<SimConnectVariable> variables;
+    std::pmr::vector<SIMCONNECT_VARIABLE_TYPE> types;
+    std::pmr::vector<size_t> typeIndices;
+    std::array<size_t, SimConnectVariableType::TYPE_COUNT> typeCounts = {};
+    // logical variables as added, duplicates point to the same physical variable
+    std::pmr::vector<SimConnectVariable> logicalVariables;
+    std::pmr::vector<size_t> physicalIndices;
+    std::pmr::vector<SimConnectUnitConversion> conversions;
+    // a name can have several physical variables with different options
+    std::pmr::unordered_multimap<uint32_t, size_t> physicalIndexByName;
+  };
+
  public:
-  explicit SimConnectDataDefinition();
+  class Builder {
+   public:
+    explicit Builder(
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+    );
+
+    Builder(
+        Builder &&other
+    ) = default;
+
+    Builder &operator=(
+        Builder &&other
+    ) = default;
+
+    Builder(
+        const Builder &other
+    ) = delete;
+
+    Builder &operator=(
+        const Builder &other
+    ) = delete;
+
+    ~Builder() = default;
+
+    Builder &reserve(
+        size_t count
+    );
+
+    Builder &add(
+        const SimConnectVariable &item
+    );
+
+    [[nodiscard]] size_t getLogicalSize() const;
+
+    SimConnectDataDefinition build();
+
+   private:
+    std::shared_ptr<Storage> storage;
+  };
+
+  explicit SimConnectDataDefinition(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+  );
 
   SimConnectDataDefinition(
       const SimConnectDataDefinition &other
-  );
+  ) = default;
+
+  SimConnectDataDefinition(
+      SimConnectDataDefinition &&other
+  ) noexcept = default;
 
   SimConnectDataDefinition &operator=(
       const SimConnectDataDefinition &other
-  );
+  ) = default;
+
+  SimConnectDataDefinition &operator=(
+      SimConnectDataDefinition &&other
+  ) noexcept = default;
 
   ~SimConnectDataDefinition();
 
+  bool operator==(
+      const SimConnectDataDefinition &other
+  ) const;
+
+  bool operator!=(
+      const SimConnectDataDefinition &other
+  ) const;
+
   void add(
       const SimConnectVariable &item
   );
 
-  SimConnectVariable get(
+  [[nodiscard]] const SimConnectVariable &get(
       size_t index
-  );
+  ) const;
+
+  [[nodiscard]] size_t size() const;
 
-  size_t size();
+  bool find(
+      const SimConnectVariable &item,
+      size_t &index
+  ) const;
 
-  SIMCONNECT_VARIABLE_TYPE getType(
+  [[nodiscard]] SIMCONNECT_VARIABLE_TYPE getType(
       size_t index
+  ) const;
+
+  static SIMCONNECT_VARIABLE_TYPE getType(
+      const SimConnectVariable &item
   );
 
-  SIMCONNECT_VARIABLE_TYPE getType(
+  [[nodiscard]] size_t getTypeIndex(
+      size_t index
+  ) const;
+
+  [[nodiscard]] size_t getTypeCount(
+      SIMCONNECT_VARIABLE_TYPE type
+  ) const;
+
+  [[nodiscard]] bool isSharedWith(
+      const SimConnectDataDefinition &other
+  ) const;
+
+  [[nodiscard]] size_t getLogicalSize() const;
+
+  [[nodiscard]] const SimConnectVariable &getLogical(
+      size_t logicalIndex
+  ) const;
+
+  [[nodiscard]] size_t getPhysicalIndex(
+      size_t logicalIndex
+  ) const;
+
+  [[nodiscard]] const SimConnectUnitConversion &getConversion(
+      size_t logicalIndex
+  ) const;
+
+  [[nodiscard]] bool isConverted(
+      size_t logicalIndex
+  ) const;
+
+  static SimConnectVariable canonicalize(
       const SimConnectVariable &item
   );
 
  private:
-  std::deque<SimConnectVariable> variables;
+  std::shared_ptr<const Storage> storage;
+
+  explicit SimConnectDataDefinition(
+      std::shared_ptr<const Storage> storage
+  );
+
+  static std::shared_ptr<Storage> createStorage(
+      std::pmr::memory_resource *resource
+  );
+
+  static void append(
+      Storage &storage,
+      const SimConnectVariable &item
+  );
+
+  static bool isSameVariable(
+      const Storage &storage,
+      size_t physicalIndex,
+      const SimConnectVariable &item,
+      SIMCONNECT_VARIABLE_TYPE type
+  );
 };
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <vector>
+#include "SimConnectUnit.h"
+#include "SimConnectVariable.h"
+
+namespace simconnect::toolbox::connection {
+class SimConnectDataFilter;
+}
+
+class simconnect::toolbox::connection::SimConnectDataFilter {
+ public:
+  SimConnectDataFilter() = default;
+
+  ~SimConnectDataFilter() = default;
+
+  size_t add(
+      size_t sourceIndex,
+      SimConnectUnitConversion conversion,
+      SIMCONNECT_VARIABLE_FILTER filter,
+      double parameter = 0
+  );
+
+  void clear();
+
+  void reset();
+
+  [[nodiscard]] size_t size() const;
+
+  void process(
+      const double *source,
+      double *target,
+      double timeStep
+  );
+
+ private:
+  struct Average {
+    size_t index = 0;
+    size_t window = 1;
+    size_t offset = 0;
+    size_t position = 0;
+    double sum = 0;
+    double scale = 1;
+  };
+
+  // structure of arrays, lowpass and derivative filters share one kernel without branches
+  std::vector<size_t> sourceIndices;
+  std::vector<double> scales;
+  std::vector<double> offsets;
+  std::vector<double> timeConstants;
+  std::vector<double> factors;
+  std::vector<double> secondStages;
+  std::vector<double> derivativeWeights;
+  std::vector<double> firstStates;
+  std::vector<double> secondStates;
+  std::vector<double> inputs;
+  // moving averages keep their samples in one ring buffer
+  std::vector<Average> averages;
+  std::vector<double> samples;
+  bool isInitialized = false;
+  double factorTimeStep = 0;
+
+  void initialize(
+      double *target
+  );
+
+  static void filter(
+      size_t count,
+      double timeStep,
+      const double *__restrict input,
+      const double *__restrict factor,
+      const double *__restrict secondStage,
+      const double *__restrict derivativeWeight,
+      double *__restrict firstState,
+      double *__restrict secondState,
+      double *__restrict output
+  );
+};
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace simconnect::toolbox::connection {
+class SimConnectDataHash;
+}
+
+class simconnect::toolbox::connection::SimConnectDataHash {
+ public:
+  // 64-bit hash of a data buffer, used to detect frames with identical content
+  static uint64_t hash(
+      const char *data,
+      size_t size
+  );
+
+ private:
+  // bytes consumed per round, one 64-bit word per accumulator
+  inline const static size_t STRIPE_SIZE = 64;
+  inline const static size_t ACCUMULATOR_COUNT = STRIPE_SIZE / sizeof(uint64_t);
+
+  static void accumulate(
+      uint64_t *__restrict accumulators,
+      const char *__restrict stripes,
+      uint64_t firstStripe,
+      size_t stripeCount
+  );
+
+  static uint64_t avalanche(
+      uint64_t value
+  );
+};
@@ -16,12 +16,20 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include <Windows.h>
 #include <SimConnect.h>
 #include "SimConnectDataDefinition.h"
 #include "SimConnectData.h"
+#include "SimConnectSystemEvent.h"
+#include "SimConnectUpdateRateScheduler.h"
 
 namespace simconnect::toolbox::connection {
 class SimConnectDataInterface;
@@ -29,7 +37,9 @@ class SimConnectDataInterface;
 
 class simconnect::toolbox::connection::SimConnectDataInterface {
  public:
-  SimConnectDataInterface() = default;
+  explicit SimConnectDataInterface(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+  );
 
   ~SimConnectDataInterface() = default;
 
@@ -37,11 +47,61 @@ class simconnect::toolbox::connection::SimConnectDataInterface {
       int configurationIndex,
       const std::string &name,
       const SimConnectDataDefinition &dataDefinition,
-      const std::shared_ptr<SimConnectData> &simConnectData
+      const std::shared_ptr<SimConnectData> &simConnectData,
+      size_t maximumChunkSize = 0
   );
 
   void disconnect();
 
+  [[nodiscard]] bool isOpen() const;
+
+  [[nodiscard]] HANDLE getDispatchEvent() const;
+
+  bool reconfigure(
+      const SimConnectDataDefinition &dataDefinition,
+      const std::shared_ptr<SimConnectData> &simConnectData
+  );
+
+  bool setStaticData(
+      const SimConnectDataDefinition &dataDefinition,
+      const std::shared_ptr<SimConnectData> &simConnectData
+  );
+
+  bool requestStaticData();
+
+  bool subscribeToSystemEvent(
+      SIMCONNECT_SYSTEM_EVENT event,
+      const std::function<void(const SIMCONNECT_RECV_EVENT *)> &callback = nullptr
+  );
+
+  bool unsubscribeFromSystemEvent(
+      SIMCONNECT_SYSTEM_EVENT event
+  );
+
+  bool subscribeToSystemState();
+
+  void setFrameCallback(
+      const std::function<void()> &callback
+  );
+
+  void setEventCallback(
+      const std::function<void(const SIMCONNECT_RECV_EVENT *)> &callback
+  );
+
+  [[nodiscard]] unsigned long long getSystemEventCount(
+      SIMCONNECT_SYSTEM_EVENT event
+  ) const;
+
+  [[nodiscard]] SimConnectSystemState getSystemState() const;
+
+  bool setUpdateIntervals(
+      const std::vector<size_t> &intervals
+  );
+
+  void setUpdateRateScheduler(
+      const std::shared_ptr<SimConnectUpdateRateScheduler> &scheduler
+  );
+
   bool requestReadData();
 
   bool requestData();
@@ -50,11 +110,79 @@ class simconnect::toolbox::connection::SimConnectDataInterface {
 
   bool sendData();
 
+  [[nodiscard]] unsigned long long getFrameCount() const;
+
+  [[nodiscard]] size_t getRequestedSize() const;
+
+  void setLatencyBudget(
+      std::chrono::microseconds budget
+  );
+
+  [[nodiscard]] std::chrono::microseconds getLatency() const;
+
+  [[nodiscard]] unsigned long long getLatencyBudgetExceededCount() const;
+
  private:
+  struct DataSegment {
+    size_t offset = 0;
+    size_t size = 0;
+  };
+
+  struct SystemEventSubscription {
+    bool isSubscribed = false;
+    std::function<void(const SIMCONNECT_RECV_EVENT *)> callback;
+    std::atomic<unsigned long long> count = 0;
+  };
+
+  using VariableMap = std::pmr::map<SIMCONNECT_VARIABLE_TYPE, std::pmr::vector<SimConnectVariable>>;
+
+  struct DataChunk {
+    explicit DataChunk(
+        std::pmr::memory_resource *resource
+    ) : variables(resource), segments(resource) {
+    }
+
+    VariableMap variables;
+    std::pmr::vector<DataSegment> segments;
+    size_t size = 0;
+    size_t interval = 1;
+    SIMCONNECT_DATA_DEFINITION_ID id = 0;
+  };
+
   bool isConnected = false;
   HANDLE hSimConnect = nullptr;
+  HANDLE hDispatchEvent = nullptr;
   std::string connectionName;
+  size_t chunkSize = 0;
+  SimConnectDataDefinition definition;
+  SIMCONNECT_DATA_DEFINITION_ID nextDefinitionId = 0;
+  std::pmr::memory_resource *memoryResource;
+  std::pmr::vector<size_t> updateIntervals;
+  std::pmr::vector<DataChunk> chunks;
+  std::pmr::vector<bool> chunkPending;
+  size_t chunkPendingCount = 0;
+  std::pmr::vector<char> frameBuffer;
+  std::pmr::vector<char> sendBuffer;
+  unsigned long long requestCount = 0;
+  unsigned long long frameCount = 0;
+  size_t requestedSize = 0;
+  std::chrono::steady_clock::time_point requestTime;
+  std::chrono::microseconds latency = std::chrono::microseconds::zero();
+  std::chrono::microseconds latencyBudget = std::chrono::microseconds::zero();
+  unsigned long long latencyBudgetExceededCount = 0;
+  std::shared_ptr<SimConnectUpdateRateScheduler> updateRateScheduler;
   std::shared_ptr<SimConnectData> data;
+  std::shared_ptr<SimConnectData> staticData;
+  std::pmr::vector<DataSegment> staticSegments;
+  std::pmr::vector<char> staticFrameBuffer;
+  std::array<SystemEventSubscription, SIMCONNECT_SYSTEM_EVENT_COUNT> systemEvents;
+  std::function<void()> frameCallback;
+  std::function<void(const SIMCONNECT_RECV_EVENT *)> eventCallback;
+  std::atomic<bool> isPaused = false;
+  std::atomic<bool> isSimRunning = false;
+  std::atomic<bool> isCrashed = false;
+
+  inline const static SIMCONNECT_DATA_DEFINITION_ID STATIC_DEFINITION_ID = 0xFFFF0000;
 
   void simConnectProcessDispatchMessage(
       SIMCONNECT_RECV *pData,
@@ -65,16 +193,47 @@ class simconnect::toolbox::connection::SimConnectDataInterface {
       const SIMCONNECT_RECV *pData
   );
 
+  void simConnectProcessSystemEvent(
+      const SIMCONNECT_RECV *pData
+  );
+
+  void resetFrame();
+
+  void publishFrame();
+
+  bool replaceDataChunks(
+      std::pmr::vector<DataChunk> &&dataChunks
+  );
+
+  static std::pmr::vector<DataChunk> getDataChunks(
+      SimConnectDataDefinition dataDefinition,
+      SimConnectData &simConnectData,
+      size_t maximumChunkSize,
+      std::pmr::memory_resource *resource,
+      const std::vector<size_t> &intervals = {}
+  );
+
+  static bool isSameDefinition(
+      const VariableMap &variables,
+      const VariableMap &otherVariables
+  );
+
+  static void clearDataChunks(
+      HANDLE connectionHandle,
+      SIMCONNECT_DATA_DEFINITION_ID firstId,
+      size_t count
+  );
+
   static bool prepareDataDefinition(
       HANDLE connectionHandle,
       SIMCONNECT_DATA_DEFINITION_ID id,
-      SimConnectDataDefinition dataDefinition
+      const VariableMap &variables
   );
 
   static bool addDataDefinition(
       HANDLE connectionHandle,
       SIMCONNECT_DATA_DEFINITION_ID id,
       SIMCONNECT_VARIABLE_TYPE dataType,
-      const std::vector<SimConnectVariable> &variables
+      const std::pmr::vector<SimConnectVariable> &variables
   );
 };
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include "SimConnectVariableType.h"
+
+namespace simconnect::toolbox::connection {
+class SimConnectDataLayout;
+}
+
+class simconnect::toolbox::connection::SimConnectDataLayout {
+ public:
+  SimConnectDataLayout() = default;
+
+  SimConnectDataLayout(
+      size_t groupAlignment,
+      const std::array<SIMCONNECT_VARIABLE_TYPE, 6> &groupOrder = DEFAULT_GROUP_ORDER
+  ) : groupAlignment(groupAlignment), groupOrder(groupOrder) {
+  }
+
+  ~SimConnectDataLayout() = default;
+
+  bool operator==(
+      const SimConnectDataLayout &other
+  ) const {
+    return groupAlignment == other.groupAlignment && groupOrder == other.groupOrder;
+  }
+
+  bool operator!=(
+      const SimConnectDataLayout &other
+  ) const {
+    return !(*this == other);
+  }
+
+  [[nodiscard]] bool isDefault() const {
+    return *this == SimConnectDataLayout();
+  }
+
+  [[nodiscard]] bool isValid() const {
+    // alignment has to be a power of two and every type group has to appear exactly once
+    if ((groupAlignment & (groupAlignment - 1)) != 0) {
+      return false;
+    }
+    auto order = groupOrder;
+    std::sort(order.begin(), order.end());
+    auto defaultOrder = DEFAULT_GROUP_ORDER;
+    std::sort(defaultOrder.begin(), defaultOrder.end());
+    return order == defaultOrder;
+  }
+
+  [[nodiscard]] size_t getAlignment(
+      SIMCONNECT_VARIABLE_TYPE type
+  ) const {
+    // without explicit alignment boolean groups are padded to 4 and all others to 8 bytes
+    if (groupAlignment > 0) {
+      return groupAlignment;
+    }
+    return type == SIMCONNECT_VARIABLE_TYPE_BOOL ? 4 : 8;
+  }
+
+  [[nodiscard]] size_t getGroupSize(
+      SIMCONNECT_VARIABLE_TYPE type,
+      size_t count
+  ) const {
+    size_t size = count * SimConnectVariableType::getSize(type);
+    size_t alignment = getAlignment(type);
+    return size + (alignment - size % alignment) % alignment;
+  }
+
+  static SimConnectDataLayout getCacheLineAligned(
+      const std::array<SIMCONNECT_VARIABLE_TYPE, 6> &groupOrder = DEFAULT_GROUP_ORDER
+  ) {
+    return SimConnectDataLayout(CACHE_LINE_SIZE, groupOrder);
+  }
+
+  size_t groupAlignment = 0;
+  std::array<SIMCONNECT_VARIABLE_TYPE, 6> groupOrder = DEFAULT_GROUP_ORDER;
+
+  inline const static size_t CACHE_LINE_SIZE = 64;
+  inline const static std::array<SIMCONNECT_VARIABLE_TYPE, 6> DEFAULT_GROUP_ORDER = {
+      SIMCONNECT_VARIABLE_TYPE_BOOL,
+      SIMCONNECT_VARIABLE_TYPE_INT32,
+      SIMCONNECT_VARIABLE_TYPE_FLOAT32,
+      SIMCONNECT_VARIABLE_TYPE_FLOAT64,
+      SIMCONNECT_VARIABLE_TYPE_LATLONALT,
+      SIMCONNECT_VARIABLE_TYPE_XYZ,
+  };
+
+  // string groups always follow the numeric groups, their slots are multiples of 8 bytes
+  inline const static std::array<SIMCONNECT_VARIABLE_TYPE, 4> STRING_GROUP_ORDER = {
+      SIMCONNECT_VARIABLE_TYPE_STRING8,
+      SIMCONNECT_VARIABLE_TYPE_STRING32,
+      SIMCONNECT_VARIABLE_TYPE_STRING64,
+      SIMCONNECT_VARIABLE_TYPE_STRING256,
+  };
+};
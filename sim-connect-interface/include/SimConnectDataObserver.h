@@ -0,0 +1,100 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "SimConnectData.h"
+#include "SimConnectDataDefinition.h"
+#include "SimConnectVariable.h"
+
+namespace simconnect::toolbox::connection {
+class SimConnectDataObserver;
+}
+
+class simconnect::toolbox::connection::SimConnectDataObserver {
+ public:
+  using Callback = std::function<void(size_t trigger, double value)>;
+
+  SimConnectDataObserver() = default;
+
+  ~SimConnectDataObserver() = default;
+
+  size_t add(
+      const SimConnectDataDefinition &dataDefinition,
+      size_t index,
+      SIMCONNECT_VARIABLE_TRIGGER trigger,
+      double threshold = 0,
+      const Callback &callback = nullptr
+  );
+
+  void clear();
+
+  void reset();
+
+  [[nodiscard]] size_t size() const;
+
+  size_t evaluate(
+      const SimConnectData &data
+  );
+
+  [[nodiscard]] bool isFired(
+      size_t trigger
+  ) const;
+
+  [[nodiscard]] double getValue(
+      size_t trigger
+  ) const;
+
+ private:
+  struct Gather {
+    std::vector<size_t> sources;
+    std::vector<size_t> targets;
+  };
+
+  // structure of arrays, so that all predicates are evaluated in one pass without branches
+  std::vector<uint8_t> triggers;
+  std::vector<double> thresholds;
+  std::vector<double> values;
+  std::vector<double> previousValues;
+  std::vector<double> referenceValues;
+  std::vector<uint8_t> hasValue;
+  std::vector<uint8_t> fired;
+  std::vector<Callback> callbacks;
+  Gather gatherBoolean;
+  Gather gatherInt32;
+  Gather gatherFloat32;
+  Gather gatherFloat64;
+
+  static size_t evaluateTriggers(
+      size_t count,
+      const uint8_t *__restrict trigger,
+      const double *__restrict threshold,
+      const double *__restrict value,
+      double *__restrict previous,
+      double *__restrict reference,
+      uint8_t *__restrict initialized,
+      uint8_t *__restrict result
+  );
+
+  template<typename T>
+  void gather(
+      SimConnectSpan<const T> group,
+      const Gather &list
+  );
+};
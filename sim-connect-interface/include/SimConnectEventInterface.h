@@ -0,0 +1,97 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include <Windows.h>
+#include <SimConnect.h>
+#include "SimConnectVariable.h"
+
+namespace simconnect::toolbox::connection {
+
+enum SIMCONNECT_EVENT_MODE {
+  SIMCONNECT_EVENT_MODE_INVALID,
+  SIMCONNECT_EVENT_MODE_TRIGGER,
+  SIMCONNECT_EVENT_MODE_VALUE,
+  SIMCONNECT_EVENT_MODE_AXIS,
+};
+
+class SimConnectEventInterface;
+}
+
+class simconnect::toolbox::connection::SimConnectEventInterface {
+ public:
+  explicit SimConnectEventInterface(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+  );
+
+  ~SimConnectEventInterface() = default;
+
+  bool connect(
+      int configurationIndex,
+      const std::string &name,
+      const std::vector<SimConnectVariable> &events,
+      DWORD priority = SIMCONNECT_GROUP_PRIORITY_HIGHEST
+  );
+
+  void disconnect();
+
+  void set(
+      size_t index,
+      double value
+  );
+
+  bool readData();
+
+  bool sendData();
+
+  [[nodiscard]] unsigned long long getTransmitCount() const;
+
+  static SIMCONNECT_EVENT_MODE getMode(
+      const SimConnectVariable &event
+  );
+
+ private:
+  struct EventState {
+    SIMCONNECT_EVENT_MODE mode = SIMCONNECT_EVENT_MODE_INVALID;
+    double input = 0;
+    DWORD value = 0;
+    DWORD sentValue = 0;
+    bool hasSentValue = false;
+    bool isPending = false;
+  };
+
+  bool isConnected = false;
+  HANDLE hSimConnect = nullptr;
+  std::string connectionName;
+  DWORD groupPriority = SIMCONNECT_GROUP_PRIORITY_HIGHEST;
+  std::pmr::vector<EventState> states;
+  std::pmr::vector<size_t> pendingEvents;
+  unsigned long long transmitCount = 0;
+
+  void simConnectProcessDispatchMessage(
+      SIMCONNECT_RECV *pData,
+      DWORD *cbData
+  );
+
+  static DWORD getEventData(
+      SIMCONNECT_EVENT_MODE mode,
+      double value
+  );
+};
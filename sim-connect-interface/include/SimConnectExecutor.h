@@ -0,0 +1,435 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+// the awaitable interface needs C++20 coroutines, the rest of the library stays on C++17
+#if !defined(__cpp_impl_coroutine)
+#error "SimConnectExecutor.h requires C++20 coroutines"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <list>
+#include <optional>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <Windows.h>
+#include <SimConnect.h>
+#include "SimConnectDataInterface.h"
+#include "SimConnectSystemEvent.h"
+
+namespace simconnect::toolbox::connection {
+class SimConnectTask;
+class SimConnectAsyncConnection;
+class SimConnectExecutor;
+}
+
+class simconnect::toolbox::connection::SimConnectTask {
+ public:
+  struct promise_type {
+    std::exception_ptr exception;
+
+    SimConnectTask get_return_object() {
+      return SimConnectTask(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    // tasks start when they are spawned on an executor
+    std::suspend_always initial_suspend() noexcept {
+      return {};
+    }
+
+    // finished tasks are destroyed by the executor
+    std::suspend_always final_suspend() noexcept {
+      return {};
+    }
+
+    void return_void() {
+    }
+
+    void unhandled_exception() {
+      exception = std::current_exception();
+    }
+  };
+
+  SimConnectTask(
+      SimConnectTask &&other
+  ) noexcept : handle(std::exchange(other.handle, nullptr)) {
+  }
+
+  SimConnectTask(
+      const SimConnectTask &other
+  ) = delete;
+
+  ~SimConnectTask() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  std::coroutine_handle<promise_type> release() {
+    return std::exchange(handle, nullptr);
+  }
+
+ private:
+  explicit SimConnectTask(
+      std::coroutine_handle<promise_type> handle
+  ) : handle(handle) {
+  }
+
+  std::coroutine_handle<promise_type> handle;
+};
+
+class simconnect::toolbox::connection::SimConnectAsyncConnection {
+ public:
+  struct Waiter {
+    std::coroutine_handle<> handle;
+    bool result = false;
+    DWORD data = 0;
+    // frame waiters are only resumed by a frame of this or a later request
+    unsigned long long generation = 0;
+  };
+
+  class FrameAwaiter {
+   public:
+    explicit FrameAwaiter(
+        SimConnectAsyncConnection &connection
+    ) : connection(connection) {
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept {
+      return !connection.dataInterface.isOpen();
+    }
+
+    void await_suspend(
+        std::coroutine_handle<> handle
+    ) {
+      waiter.handle = handle;
+      connection.frameWaiters.push_back(&waiter);
+    }
+
+    // false when the connection was closed
+    [[nodiscard]] bool await_resume() const noexcept {
+      return waiter.result;
+    }
+
+   private:
+    SimConnectAsyncConnection &connection;
+    Waiter waiter;
+  };
+
+  class EventAwaiter {
+   public:
+    EventAwaiter(
+        SimConnectAsyncConnection &connection,
+        SIMCONNECT_SYSTEM_EVENT event
+    ) : connection(connection), event(event) {
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept {
+      return !connection.dataInterface.isOpen();
+    }
+
+    bool await_suspend(
+        std::coroutine_handle<> handle
+    ) {
+      // the first task waiting for an event subscribes to it
+      if (!connection.dataInterface.subscribeToSystemEvent(event)) {
+        return false;
+      }
+      waiter.handle = handle;
+      connection.eventWaiters[event].push_back(&waiter);
+      return true;
+    }
+
+    // data of the event, empty when the connection was closed
+    [[nodiscard]] std::optional<DWORD> await_resume() const noexcept {
+      if (!waiter.result) {
+        return std::nullopt;
+      }
+      return waiter.data;
+    }
+
+   private:
+    SimConnectAsyncConnection &connection;
+    SIMCONNECT_SYSTEM_EVENT event;
+    Waiter waiter;
+  };
+
+  class WriteAwaiter {
+   public:
+    explicit WriteAwaiter(
+        SimConnectAsyncConnection &connection
+    ) : connection(connection) {
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept {
+      return !connection.dataInterface.isOpen();
+    }
+
+    bool await_suspend(
+        std::coroutine_handle<> handle
+    ) {
+      // the write is acknowledged by a frame requested after the data was sent, not by one already pending
+      if (!connection.dataInterface.sendData()) {
+        return false;
+      }
+      waiter.handle = handle;
+      waiter.generation = connection.requestGeneration + 1;
+      connection.frameWaiters.push_back(&waiter);
+      return true;
+    }
+
+    // false when sending failed or the connection was closed
+    [[nodiscard]] bool await_resume() const noexcept {
+      return waiter.result;
+    }
+
+   private:
+    SimConnectAsyncConnection &connection;
+    Waiter waiter;
+  };
+
+  SimConnectAsyncConnection(
+      SimConnectDataInterface &dataInterface,
+      std::deque<std::coroutine_handle<>> &ready
+  ) : dataInterface(dataInterface), ready(ready) {
+  }
+
+  ~SimConnectAsyncConnection() = default;
+
+  FrameAwaiter nextFrame() {
+    return FrameAwaiter(*this);
+  }
+
+  EventAwaiter event(
+      SIMCONNECT_SYSTEM_EVENT event
+  ) {
+    return {*this, event};
+  }
+
+  WriteAwaiter write() {
+    return WriteAwaiter(*this);
+  }
+
+  SimConnectDataInterface &getDataInterface() {
+    return dataInterface;
+  }
+
+ private:
+  friend class SimConnectExecutor;
+
+  SimConnectDataInterface &dataInterface;
+  std::deque<std::coroutine_handle<>> &ready;
+  std::vector<Waiter *> frameWaiters;
+  std::array<std::vector<Waiter *>, SIMCONNECT_SYSTEM_EVENT_COUNT> eventWaiters;
+  bool isFrameRequested = false;
+  unsigned long long requestGeneration = 0;
+
+  [[nodiscard]] bool hasWaiters() const {
+    if (!frameWaiters.empty()) {
+      return true;
+    }
+    for (const auto &waiters : eventWaiters) {
+      if (!waiters.empty()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void wake(
+      std::vector<Waiter *> &waiters,
+      bool result,
+      DWORD data
+  ) {
+    // all tasks waiting for the same thing are resumed by the executor in the order they started waiting
+    for (auto *waiter : waiters) {
+      waiter->result = result;
+      waiter->data = data;
+      ready.push_back(waiter->handle);
+    }
+    waiters.clear();
+  }
+
+  void wakeFrame() {
+    // waiters for a later request keep waiting, the executor requests the next frame for them
+    std::vector<Waiter *> due;
+    auto it = std::stable_partition(frameWaiters.begin(), frameWaiters.end(), [this](const Waiter *waiter) {
+      return waiter->generation > requestGeneration;
+    });
+    due.assign(it, frameWaiters.end());
+    frameWaiters.erase(it, frameWaiters.end());
+    wake(due, true, 0);
+  }
+
+  void close() {
+    // a closed connection resumes every waiting task with a failed result
+    isFrameRequested = false;
+    wake(frameWaiters, false, 0);
+    for (auto &waiters : eventWaiters) {
+      wake(waiters, false, 0);
+    }
+  }
+};
+
+class simconnect::toolbox::connection::SimConnectExecutor {
+ public:
+  SimConnectExecutor() = default;
+
+  SimConnectExecutor(
+      const SimConnectExecutor &other
+  ) = delete;
+
+  ~SimConnectExecutor() {
+    // detach from the interfaces and destroy tasks that did not finish
+    for (auto &connection : connections) {
+      connection.dataInterface.setFrameCallback(nullptr);
+      connection.dataInterface.setEventCallback(nullptr);
+    }
+    for (auto *address : tasks) {
+      std::coroutine_handle<>::from_address(address).destroy();
+    }
+  }
+
+  SimConnectAsyncConnection &attach(
+      SimConnectDataInterface &dataInterface
+  ) {
+    // all connections are waited for at once
+    if (connections.size() >= MAXIMUM_WAIT_OBJECTS) {
+      throw std::length_error("Too many connections for one executor!");
+    }
+    auto &connection = connections.emplace_back(dataInterface, ready);
+
+    // frames and events of the interface resume the tasks waiting for them
+    dataInterface.setFrameCallback(
+        [&connection]() {
+          connection.isFrameRequested = false;
+          connection.wakeFrame();
+        }
+    );
+    dataInterface.setEventCallback(
+        [&connection](const SIMCONNECT_RECV_EVENT *event) {
+          if (event->uEventID < connection.eventWaiters.size()) {
+            connection.wake(connection.eventWaiters[event->uEventID], true, event->dwData);
+          }
+        }
+    );
+    return connection;
+  }
+
+  void spawn(
+      SimConnectTask task
+  ) {
+    auto handle = task.release();
+    tasks.insert(handle.address());
+    ready.push_back(handle);
+  }
+
+  [[nodiscard]] size_t getTaskCount() const {
+    return tasks.size();
+  }
+
+  bool run(
+      DWORD timeout = INFINITE
+  ) {
+    std::vector<HANDLE> dispatchEvents;
+    while (!tasks.empty()) {
+      // resume ready tasks, tasks woken meanwhile are resumed in the same pass
+      while (!ready.empty()) {
+        auto handle = ready.front();
+        ready.pop_front();
+        handle.resume();
+        if (handle.done()) {
+          finish(handle);
+        }
+      }
+      if (tasks.empty()) {
+        break;
+      }
+
+      // one request per connection serves all tasks waiting for the next frame
+      dispatchEvents.clear();
+      for (auto &connection : connections) {
+        if (!connection.dataInterface.isOpen()) {
+          connection.close();
+          continue;
+        }
+        if (!connection.frameWaiters.empty() && !connection.isFrameRequested) {
+          if (!connection.dataInterface.requestData()) {
+            connection.close();
+            continue;
+          }
+          connection.isFrameRequested = true;
+          connection.requestGeneration++;
+        }
+        if (connection.hasWaiters()) {
+          dispatchEvents.push_back(connection.dataInterface.getDispatchEvent());
+        }
+      }
+      if (!ready.empty()) {
+        continue;
+      }
+
+      // remaining tasks wait for something none of the connections can deliver
+      if (dispatchEvents.empty()) {
+        return false;
+      }
+
+      // sleep until SimConnect signals a message for one of the connections
+      DWORD result = WaitForMultipleObjects(
+          static_cast<DWORD>(dispatchEvents.size()),
+          dispatchEvents.data(),
+          FALSE,
+          timeout
+      );
+      if (result == WAIT_TIMEOUT || result == WAIT_FAILED) {
+        return false;
+      }
+
+      // process messages, the callbacks move waiting tasks into the ready queue
+      for (auto &connection : connections) {
+        if (connection.dataInterface.isOpen()) {
+          connection.dataInterface.readData();
+        }
+      }
+    }
+    return true;
+  }
+
+ private:
+  std::list<SimConnectAsyncConnection> connections;
+  std::deque<std::coroutine_handle<>> ready;
+  std::unordered_set<void *> tasks;
+
+  void finish(
+      std::coroutine_handle<> handle
+  ) {
+    // exceptions of a task are passed on to the caller of run
+    auto task = std::coroutine_handle<SimConnectTask::promise_type>::from_address(handle.address());
+    auto exception = task.promise().exception;
+    tasks.erase(handle.address());
+    task.destroy();
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+};
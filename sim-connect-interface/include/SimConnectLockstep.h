@@ -0,0 +1,83 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include "SimConnectDataInterface.h"
+#include "SimConnectEventInterface.h"
+
+namespace simconnect::toolbox::connection {
+class SimConnectLockstep;
+}
+
+class simconnect::toolbox::connection::SimConnectLockstep {
+ public:
+  SimConnectLockstep() = default;
+
+  ~SimConnectLockstep() = default;
+
+  bool connect(
+      int configurationIndex,
+      const std::string &name,
+      const std::shared_ptr<SimConnectDataInterface> &dataInterface,
+      std::chrono::milliseconds timeout = std::chrono::milliseconds(1000)
+  );
+
+  void disconnect();
+
+  bool start();
+
+  bool advance();
+
+  bool stop();
+
+  [[nodiscard]] unsigned long long getStepCount() const;
+
+  [[nodiscard]] unsigned long long getFrameCount() const;
+
+  [[nodiscard]] double getFramesPerSecond() const;
+
+ private:
+  enum LOCKSTEP_EVENT {
+    LOCKSTEP_EVENT_PAUSE_ON,
+    LOCKSTEP_EVENT_PAUSE_OFF,
+  };
+
+  bool isRunning = false;
+  std::shared_ptr<SimConnectDataInterface> data;
+  SimConnectEventInterface events;
+  std::chrono::milliseconds frameTimeout = std::chrono::milliseconds(1000);
+  std::chrono::steady_clock::time_point startTime;
+  unsigned long long stepCount = 0;
+  unsigned long long frameCount = 0;
+
+  bool transmit(
+      LOCKSTEP_EVENT event
+  );
+
+  bool waitForPause(
+      bool paused
+  );
+
+  bool waitForMessage(
+      std::chrono::steady_clock::time_point timeout
+  );
+
+  [[nodiscard]] unsigned long long getRunningFrames() const;
+};
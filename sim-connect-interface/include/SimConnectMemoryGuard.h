@@ -0,0 +1,78 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+namespace simconnect::toolbox::connection {
+class SimConnectMemoryGuard;
+}
+
+class simconnect::toolbox::connection::SimConnectMemoryGuard : public std::pmr::memory_resource {
+ public:
+  explicit SimConnectMemoryGuard(
+      bool isStrict = false
+  );
+
+  ~SimConnectMemoryGuard() override;
+
+  SimConnectMemoryGuard(
+      SimConnectMemoryGuard const &
+  ) = delete;
+
+  void operator=(
+      SimConnectMemoryGuard const &
+  ) = delete;
+
+  [[nodiscard]] unsigned long long getAllocationCount() const;
+
+  [[nodiscard]] size_t getAllocatedSize() const;
+
+  [[nodiscard]] bool isUntouched() const;
+
+  // called by a replacement of the global operator new of the application, the library does not replace it
+  static void recordGlobalAllocation(
+      size_t bytes
+  );
+
+ protected:
+  void *do_allocate(
+      size_t bytes,
+      size_t alignment
+  ) override;
+
+  void do_deallocate(
+      void *p,
+      size_t bytes,
+      size_t alignment
+  ) override;
+
+  [[nodiscard]] bool do_is_equal(
+      const std::pmr::memory_resource &other
+  ) const noexcept override;
+
+ private:
+  inline static std::atomic<SimConnectMemoryGuard *> active = nullptr;
+
+  bool isStrict;
+  std::pmr::memory_resource *previous;
+  SimConnectMemoryGuard *previousActive;
+  std::atomic<unsigned long long> allocationCount = 0;
+  std::atomic<size_t> allocatedSize = 0;
+};
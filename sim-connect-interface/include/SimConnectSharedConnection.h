@@ -0,0 +1,119 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "SimConnectData.h"
+#include "SimConnectDataArena.h"
+#include "SimConnectDataDefinition.h"
+#include "SimConnectDataInterface.h"
+#include "SimConnectUpdateRateScheduler.h"
+#include "SimConnectVariable.h"
+
+namespace simconnect::toolbox::connection {
+class SimConnectSharedConnection;
+}
+
+class simconnect::toolbox::connection::SimConnectSharedConnection {
+ public:
+  explicit SimConnectSharedConnection(
+      std::string connectionName
+  );
+
+  ~SimConnectSharedConnection();
+
+  SimConnectSharedConnection(
+      SimConnectSharedConnection const &
+  ) = delete;
+
+  void operator=(
+      SimConnectSharedConnection const &
+  ) = delete;
+
+  static std::shared_ptr<SimConnectSharedConnection> get(
+      const std::string &connectionName,
+      SIMCONNECT_VARIABLE_PRIORITY priority
+  );
+
+  size_t add(
+      const SimConnectVariable &variable
+  );
+
+  size_t addStatic(
+      const SimConnectVariable &variable
+  );
+
+  bool connect(
+      int configurationIndex,
+      const std::string &name
+  );
+
+  size_t join();
+
+  void leave(
+      size_t participant
+  );
+
+  bool update(
+      size_t participant
+  );
+
+  [[nodiscard]] const SimConnectDataDefinition &getDataDefinition() const;
+
+  [[nodiscard]] const std::shared_ptr<SimConnectData> &getData() const;
+
+  [[nodiscard]] const SimConnectDataDefinition &getStaticDataDefinition() const;
+
+  [[nodiscard]] const std::shared_ptr<SimConnectData> &getStaticData() const;
+
+  [[nodiscard]] const std::shared_ptr<SimConnectDataInterface> &getDataInterface() const;
+
+  [[nodiscard]] unsigned long long getStep() const;
+
+  inline const static std::string MISMATCH_COUNT_VARIABLE = "FRAME MISMATCH COUNT";
+  inline const static std::string UNCHANGED_VARIABLE = "FRAME UNCHANGED";
+  inline const static std::string FRAME_TIME_VARIABLE = "SIMULATION TIME";
+  inline const static std::string FRAME_TIME_UNIT = "SECONDS";
+
+ private:
+  struct Participant {
+    bool isActive = false;
+    unsigned long long step = 0;
+  };
+
+  mutable std::mutex mutex;
+  std::string connectionName;
+  SimConnectDataDefinition dataDefinition;
+  SimConnectDataDefinition staticDataDefinition;
+  std::shared_ptr<SimConnectData> data;
+  std::shared_ptr<SimConnectData> staticData;
+  std::shared_ptr<SimConnectDataInterface> dataInterface;
+  std::shared_ptr<SimConnectUpdateRateScheduler> updateRateScheduler;
+  bool isChanged = false;
+  bool isStaticChanged = false;
+  std::vector<Participant> participants;
+  unsigned long long step = 0;
+
+  inline static std::mutex registryMutex;
+  inline static std::map<std::pair<std::string, SIMCONNECT_VARIABLE_PRIORITY>,
+                         std::weak_ptr<SimConnectSharedConnection>> registry;
+};
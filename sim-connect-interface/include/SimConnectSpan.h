@@ -0,0 +1,78 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace simconnect::toolbox::connection {
+template<class T>
+class SimConnectSpan;
+}
+
+template<class T>
+class simconnect::toolbox::connection::SimConnectSpan {
+ public:
+  SimConnectSpan() = default;
+
+  SimConnectSpan(
+      T *data,
+      size_t count
+  ) : pData(data), count(count) {
+  }
+
+  ~SimConnectSpan() = default;
+
+  [[nodiscard]] T *data() const {
+    return pData;
+  }
+
+  [[nodiscard]] size_t size() const {
+    return count;
+  }
+
+  [[nodiscard]] bool empty() const {
+    return count == 0;
+  }
+
+  [[nodiscard]] T *begin() const {
+    return pData;
+  }
+
+  [[nodiscard]] T *end() const {
+    return pData + count;
+  }
+
+  T &operator[](
+      size_t index
+  ) const {
+    return pData[index];
+  }
+
+  T &at(
+      size_t index
+  ) const {
+    if (index >= count) {
+      throw std::out_of_range("Index is out of range!");
+    }
+    return pData[index];
+  }
+
+ private:
+  T *pData = nullptr;
+  size_t count = 0;
+};
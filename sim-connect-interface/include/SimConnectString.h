@@ -0,0 +1,154 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace simconnect::toolbox::connection {
+class SimConnectStringPool;
+class SimConnectString;
+}
+
+class simconnect::toolbox::connection::SimConnectStringPool {
+ public:
+  SimConnectStringPool(
+      SimConnectStringPool const &
+  ) = delete;
+
+  void operator=(
+      SimConnectStringPool const &
+  ) = delete;
+
+  static uint32_t intern(
+      std::string_view value,
+      const std::string **pValue = nullptr
+  );
+
+  static const std::string &get(
+      uint32_t id
+  );
+
+  static size_t size();
+
+ private:
+  SimConnectStringPool();
+
+  ~SimConnectStringPool() = default;
+
+  mutable std::shared_mutex mutex;
+  std::deque<std::string> strings;
+  std::unordered_map<std::string_view, uint32_t> index;
+
+  static SimConnectStringPool &getInstance();
+};
+
+class simconnect::toolbox::connection::SimConnectString {
+ public:
+  SimConnectString() : SimConnectString(std::string_view()) {
+  }
+
+  explicit SimConnectString(
+      std::string_view value
+  ) {
+    id = SimConnectStringPool::intern(value, &pValue);
+  }
+
+  ~SimConnectString() = default;
+
+  [[nodiscard]] uint32_t getId() const {
+    return id;
+  }
+
+  [[nodiscard]] const std::string &str() const {
+    return *pValue;
+  }
+
+  [[nodiscard]] const char *c_str() const {
+    return pValue->c_str();
+  }
+
+  [[nodiscard]] bool empty() const {
+    return pValue->empty();
+  }
+
+  operator const std::string &() const {
+    return *pValue;
+  }
+
+  bool operator==(
+      const SimConnectString &other
+  ) const {
+    return id == other.id;
+  }
+
+  bool operator!=(
+      const SimConnectString &other
+  ) const {
+    return id != other.id;
+  }
+
+  bool operator==(
+      const std::string &other
+  ) const {
+    return *pValue == other;
+  }
+
+  bool operator!=(
+      const std::string &other
+  ) const {
+    return *pValue != other;
+  }
+
+  bool operator==(
+      const char *other
+  ) const {
+    return *pValue == other;
+  }
+
+  bool operator!=(
+      const char *other
+  ) const {
+    return *pValue != other;
+  }
+
+  friend std::ostream &operator<<(
+      std::ostream &stream,
+      const SimConnectString &value
+  ) {
+    return stream << *value.pValue;
+  }
+
+ private:
+  const std::string *pValue = nullptr;
+  uint32_t id = 0;
+};
+
+template<>
+struct std::hash<simconnect::toolbox::connection::SimConnectString> {
+  size_t operator()(
+      const simconnect::toolbox::connection::SimConnectString &value
+  ) const noexcept {
+    return value.getId();
+  }
+};
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <string>
+
+namespace simconnect::toolbox::connection {
+
+enum SIMCONNECT_SYSTEM_EVENT {
+  SIMCONNECT_SYSTEM_EVENT_1SEC,
+  SIMCONNECT_SYSTEM_EVENT_4SEC,
+  SIMCONNECT_SYSTEM_EVENT_6HZ,
+  SIMCONNECT_SYSTEM_EVENT_AIRCRAFT_LOADED,
+  SIMCONNECT_SYSTEM_EVENT_CRASHED,
+  SIMCONNECT_SYSTEM_EVENT_CRASH_RESET,
+  SIMCONNECT_SYSTEM_EVENT_FLIGHT_LOADED,
+  SIMCONNECT_SYSTEM_EVENT_FLIGHT_SAVED,
+  SIMCONNECT_SYSTEM_EVENT_FLIGHT_PLAN_ACTIVATED,
+  SIMCONNECT_SYSTEM_EVENT_FLIGHT_PLAN_DEACTIVATED,
+  SIMCONNECT_SYSTEM_EVENT_FRAME,
+  SIMCONNECT_SYSTEM_EVENT_PAUSE,
+  SIMCONNECT_SYSTEM_EVENT_PAUSED,
+  SIMCONNECT_SYSTEM_EVENT_PAUSE_FRAME,
+  SIMCONNECT_SYSTEM_EVENT_POSITION_CHANGED,
+  SIMCONNECT_SYSTEM_EVENT_SIM,
+  SIMCONNECT_SYSTEM_EVENT_SIM_START,
+  SIMCONNECT_SYSTEM_EVENT_SIM_STOP,
+  SIMCONNECT_SYSTEM_EVENT_SOUND,
+  SIMCONNECT_SYSTEM_EVENT_UNPAUSED,
+  SIMCONNECT_SYSTEM_EVENT_VIEW,
+  SIMCONNECT_SYSTEM_EVENT_COUNT,
+};
+
+enum SIMCONNECT_SYSTEM_STATE {
+  SIMCONNECT_SYSTEM_STATE_INVALID,
+  SIMCONNECT_SYSTEM_STATE_PAUSED,
+  SIMCONNECT_SYSTEM_STATE_SIM_RUNNING,
+  SIMCONNECT_SYSTEM_STATE_CRASHED,
+  SIMCONNECT_SYSTEM_STATE_AIRCRAFT_LOAD_COUNT,
+  SIMCONNECT_SYSTEM_STATE_FLIGHT_LOAD_COUNT,
+};
+
+struct SimConnectSystemState {
+  bool isPaused = false;
+  bool isSimRunning = false;
+  bool isCrashed = false;
+  // a flight load usually loads the aircraft as well, so both are counted separately
+  unsigned long long aircraftLoadCount = 0;
+  unsigned long long flightLoadCount = 0;
+};
+
+class SimConnectSystemEvent {
+ public:
+  SimConnectSystemEvent() = delete;
+
+  ~SimConnectSystemEvent() = delete;
+
+  static const char *getName(
+      SIMCONNECT_SYSTEM_EVENT event
+  ) {
+    return NAMES[event];
+  }
+
+  static SIMCONNECT_SYSTEM_STATE getState(
+      const std::string &name
+  ) {
+    auto it = STATES.find(name);
+    return it != STATES.end() ? it->second : SIMCONNECT_SYSTEM_STATE_INVALID;
+  }
+
+  static double getValue(
+      SIMCONNECT_SYSTEM_STATE state,
+      const SimConnectSystemState &systemState
+  ) {
+    switch (state) {
+      case SIMCONNECT_SYSTEM_STATE_PAUSED:
+        return systemState.isPaused ? 1.0 : 0.0;
+
+      case SIMCONNECT_SYSTEM_STATE_SIM_RUNNING:
+        return systemState.isSimRunning ? 1.0 : 0.0;
+
+      case SIMCONNECT_SYSTEM_STATE_CRASHED:
+        return systemState.isCrashed ? 1.0 : 0.0;
+
+      case SIMCONNECT_SYSTEM_STATE_AIRCRAFT_LOAD_COUNT:
+        return static_cast<double>(systemState.aircraftLoadCount);
+
+      case SIMCONNECT_SYSTEM_STATE_FLIGHT_LOAD_COUNT:
+        return static_cast<double>(systemState.flightLoadCount);
+
+      default:
+        return 0.0;
+    }
+  }
+
+ private:
+  // names as expected by SimConnect_SubscribeToSystemEvent, indexed by event
+  inline static const std::array<const char *, SIMCONNECT_SYSTEM_EVENT_COUNT> NAMES = {
+      "1sec",
+      "4sec",
+      "6Hz",
+      "AircraftLoaded",
+      "Crashed",
+      "CrashReset",
+      "FlightLoaded",
+      "FlightSaved",
+      "FlightPlanActivated",
+      "FlightPlanDeactivated",
+      "Frame",
+      "Pause",
+      "Paused",
+      "PauseFrame",
+      "PositionChanged",
+      "Sim",
+      "SimStart",
+      "SimStop",
+      "Sound",
+      "Unpaused",
+      "View",
+  };
+
+  // pseudo variables derived from system events
+  inline static const std::map<std::string, SIMCONNECT_SYSTEM_STATE> STATES = {
+      {"SYSTEM PAUSED", SIMCONNECT_SYSTEM_STATE_PAUSED},
+      {"SYSTEM SIM RUNNING", SIMCONNECT_SYSTEM_STATE_SIM_RUNNING},
+      {"SYSTEM CRASHED", SIMCONNECT_SYSTEM_STATE_CRASHED},
+      {"SYSTEM AIRCRAFT LOAD COUNT", SIMCONNECT_SYSTEM_STATE_AIRCRAFT_LOAD_COUNT},
+      {"SYSTEM FLIGHT LOAD COUNT", SIMCONNECT_SYSTEM_STATE_FLIGHT_LOAD_COUNT},
+  };
+};
+
+}
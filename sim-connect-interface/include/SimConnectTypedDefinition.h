@@ -0,0 +1,348 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <Windows.h>
+#include <SimConnect.h>
+#include "SimConnectVariableLookupTable.h"
+#include "SimConnectVariableType.h"
+
+// declares a compile time variable descriptor, the name has to be upper case
+#define SIMCONNECT_TYPED_VARIABLE(IDENTIFIER, NAME, UNIT, TYPE)  \
+  struct IDENTIFIER {                                            \
+    static constexpr const char *name = NAME;                    \
+    static constexpr const char *unit = UNIT;                    \
+    using type = TYPE;                                           \
+  }
+
+namespace simconnect::toolbox::connection {
+
+template<typename T>
+struct SimConnectTypeTraits {
+  static constexpr SIMCONNECT_VARIABLE_TYPE type = SIMCONNECT_VARIABLE_TYPE_INVALID;
+};
+
+template<>
+struct SimConnectTypeTraits<int32_t> {
+  static constexpr SIMCONNECT_VARIABLE_TYPE type = SIMCONNECT_VARIABLE_TYPE_INT32;
+};
+
+template<>
+struct SimConnectTypeTraits<float> {
+  static constexpr SIMCONNECT_VARIABLE_TYPE type = SIMCONNECT_VARIABLE_TYPE_FLOAT32;
+};
+
+template<>
+struct SimConnectTypeTraits<double> {
+  static constexpr SIMCONNECT_VARIABLE_TYPE type = SIMCONNECT_VARIABLE_TYPE_FLOAT64;
+};
+
+template<>
+struct SimConnectTypeTraits<SIMCONNECT_DATA_LATLONALT> {
+  static constexpr SIMCONNECT_VARIABLE_TYPE type = SIMCONNECT_VARIABLE_TYPE_LATLONALT;
+};
+
+template<>
+struct SimConnectTypeTraits<SIMCONNECT_DATA_XYZ> {
+  static constexpr SIMCONNECT_VARIABLE_TYPE type = SIMCONNECT_VARIABLE_TYPE_XYZ;
+};
+
+template<typename... Variables>
+class SimConnectTypedDefinition;
+
+template<typename Definition>
+class SimConnectTypedDataInterface;
+}
+
+template<typename... Variables>
+class simconnect::toolbox::connection::SimConnectTypedDefinition {
+ private:
+  template<typename Variable>
+  static constexpr bool isTypeMatching() {
+    // booleans are transferred as int32
+    constexpr auto expected = SimConnectVariableLookupTable::lookupDataType(Variable::name);
+    constexpr auto actual = SimConnectTypeTraits<typename Variable::type>::type;
+    return expected == actual || (expected == SIMCONNECT_VARIABLE_TYPE_BOOL && actual == SIMCONNECT_VARIABLE_TYPE_INT32);
+  }
+
+  static_assert(sizeof...(Variables) > 0, "Definition needs at least one variable!");
+  static_assert(
+      ((SimConnectTypeTraits<typename Variables::type>::type != SIMCONNECT_VARIABLE_TYPE_INVALID) && ...),
+      "Type is not supported!"
+  );
+  static_assert(
+      ((SimConnectVariableLookupTable::lookupDataType(Variables::name) != SIMCONNECT_VARIABLE_TYPE_INVALID) && ...),
+      "Variable is not known!"
+  );
+  static_assert((isTypeMatching<Variables>() && ...), "Type does not match the lookup table!");
+
+  static constexpr std::array<size_t, sizeof...(Variables)> SIZES = {sizeof(typename Variables::type)...};
+
+ public:
+  static constexpr size_t count = sizeof...(Variables);
+
+  static constexpr size_t size = (sizeof(typename Variables::type) + ...);
+
+  template<typename Variable>
+  static constexpr size_t indexOf() {
+    constexpr std::array<bool, count> matches = {std::is_same_v<Variable, Variables>...};
+    for (size_t index = 0; index < count; ++index) {
+      if (matches[index]) {
+        return index;
+      }
+    }
+    return count;
+  }
+
+  template<typename Variable>
+  static constexpr size_t offsetOf() {
+    static_assert(indexOf<Variable>() < count, "Variable is not part of the definition!");
+    // variables are packed in the order of registration
+    size_t offset = 0;
+    for (size_t index = 0; index < indexOf<Variable>(); ++index) {
+      offset += SIZES[index];
+    }
+    return offset;
+  }
+
+  // frame as sent by SimConnect, received data can be used in place
+  class Frame {
+   public:
+    template<typename Variable>
+    [[nodiscard]] typename Variable::type get() const {
+      typename Variable::type value;
+      std::memcpy(&value, data.data() + offsetOf<Variable>(), sizeof(value));
+      return value;
+    }
+
+    template<typename Variable>
+    void set(
+        const typename Variable::type &value
+    ) {
+      std::memcpy(data.data() + offsetOf<Variable>(), &value, sizeof(value));
+    }
+
+    [[nodiscard]] const char *getBuffer() const {
+      return data.data();
+    }
+
+    char *getBuffer() {
+      return data.data();
+    }
+
+   private:
+    std::array<char, size> data = {};
+  };
+
+  static_assert(sizeof(Frame) == size, "Frame is not packed!");
+
+  static const Frame &fromBuffer(
+      const void *pBuffer
+  ) {
+    return *reinterpret_cast<const Frame *>(pBuffer);
+  }
+
+  static bool addToDataDefinition(
+      HANDLE connectionHandle,
+      SIMCONNECT_DATA_DEFINITION_ID id
+  ) {
+    // registration order is the order of the variables
+    return (addVariable<Variables>(connectionHandle, id) && ...);
+  }
+
+ private:
+  template<typename Variable>
+  static bool addVariable(
+      HANDLE connectionHandle,
+      SIMCONNECT_DATA_DEFINITION_ID id
+  ) {
+    constexpr auto type = SimConnectTypeTraits<typename Variable::type>::type;
+    HRESULT result = SimConnect_AddToDataDefinition(
+        connectionHandle,
+        id,
+        Variable::name,
+        SimConnectVariableType::isStruct(type) || SimConnectVariableType::isString(type) ? nullptr : Variable::unit,
+        SimConnectVariableType::convert(type)
+    );
+    return result == S_OK;
+  }
+};
+
+template<typename Definition>
+class simconnect::toolbox::connection::SimConnectTypedDataInterface {
+ public:
+  using Frame = typename Definition::Frame;
+
+  SimConnectTypedDataInterface() = default;
+
+  ~SimConnectTypedDataInterface() {
+    disconnect();
+  }
+
+  bool connect(
+      int configurationIndex,
+      const std::string &name
+  ) {
+    // store connection name
+    connectionName = name;
+
+    // connect
+    HRESULT result = SimConnect_Open(
+        &hSimConnect,
+        connectionName.c_str(),
+        nullptr,
+        0,
+        nullptr,
+        configurationIndex
+    );
+    if (S_OK != result) {
+      return false;
+    }
+    isConnected = true;
+
+    // add data to definition
+    if (!Definition::addToDataDefinition(hSimConnect, DEFINITION_ID)) {
+      disconnect();
+      return false;
+    }
+
+    // success
+    return true;
+  }
+
+  void disconnect() {
+    if (isConnected) {
+      SimConnect_Close(hSimConnect);
+      isConnected = false;
+      hSimConnect = nullptr;
+    }
+  }
+
+  bool requestData() {
+    // check if we are connected
+    if (!isConnected) {
+      return false;
+    }
+
+    // request data
+    HRESULT result = SimConnect_RequestDataOnSimObjectType(
+        hSimConnect,
+        DEFINITION_ID,
+        DEFINITION_ID,
+        0,
+        SIMCONNECT_SIMOBJECT_TYPE_USER
+    );
+    return result == S_OK;
+  }
+
+  bool readData() {
+    // check if we are connected
+    if (!isConnected) {
+      return false;
+    }
+
+    // get next dispatch message(s) and process them
+    DWORD cbData;
+    SIMCONNECT_RECV *pData;
+    while (isConnected && SUCCEEDED(SimConnect_GetNextDispatch(hSimConnect, &pData, &cbData))) {
+      simConnectProcessDispatchMessage(pData);
+    }
+
+    // success
+    return true;
+  }
+
+  bool requestReadData() {
+    return requestData() && readData();
+  }
+
+  bool sendData(
+      const Frame &value
+  ) {
+    // check if we are connected
+    if (!isConnected) {
+      return false;
+    }
+
+    // set data
+    HRESULT result = SimConnect_SetDataOnSimObject(
+        hSimConnect,
+        DEFINITION_ID,
+        SIMCONNECT_OBJECT_ID_USER,
+        0,
+        0,
+        static_cast<DWORD>(Definition::size),
+        const_cast<char *>(value.getBuffer())
+    );
+    return result == S_OK;
+  }
+
+  [[nodiscard]] const Frame &getFrame() const {
+    return frame;
+  }
+
+  [[nodiscard]] unsigned long long getFrameCount() const {
+    return frameCount;
+  }
+
+ private:
+  bool isConnected = false;
+  HANDLE hSimConnect = nullptr;
+  std::string connectionName;
+  Frame frame;
+  unsigned long long frameCount = 0;
+
+  inline static const SIMCONNECT_DATA_DEFINITION_ID DEFINITION_ID = 0;
+
+  void simConnectProcessDispatchMessage(
+      SIMCONNECT_RECV *pData
+  ) {
+    switch (pData->dwID) {
+      case SIMCONNECT_RECV_ID_SIMOBJECT_DATA_BYTYPE: {
+        // the received data is the frame itself
+        auto *simObjectDataByType = (SIMCONNECT_RECV_SIMOBJECT_DATA_BYTYPE *) pData;
+        if (simObjectDataByType->dwRequestID == DEFINITION_ID) {
+          frame = Definition::fromBuffer(&simObjectDataByType->dwData);
+          frameCount++;
+        }
+        break;
+      }
+
+      case SIMCONNECT_RECV_ID_QUIT:
+        // connection lost
+        std::cout << "Closed SimConnect connection ('" << connectionName << "')" << std::endl;
+        disconnect();
+        break;
+
+      case SIMCONNECT_RECV_ID_EXCEPTION:
+        // exception
+        std::cout << "Exception in SimConnect connection ('" << connectionName << "'): ";
+        std::cout << ((SIMCONNECT_RECV_EXCEPTION *) pData)->dwException << std::endl;
+        break;
+
+      default:
+        break;
+    }
+  }
+};
@@ -0,0 +1,415 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <string_view>
+
+namespace simconnect::toolbox::connection {
+
+enum SIMCONNECT_UNIT_QUANTITY {
+  SIMCONNECT_UNIT_QUANTITY_INVALID,
+  SIMCONNECT_UNIT_QUANTITY_NONE,
+  SIMCONNECT_UNIT_QUANTITY_RATIO,
+  SIMCONNECT_UNIT_QUANTITY_LENGTH,
+  SIMCONNECT_UNIT_QUANTITY_AREA,
+  SIMCONNECT_UNIT_QUANTITY_VOLUME,
+  SIMCONNECT_UNIT_QUANTITY_SPEED,
+  SIMCONNECT_UNIT_QUANTITY_ACCELERATION,
+  SIMCONNECT_UNIT_QUANTITY_ANGLE,
+  SIMCONNECT_UNIT_QUANTITY_ANGULAR_VELOCITY,
+  SIMCONNECT_UNIT_QUANTITY_ANGULAR_ACCELERATION,
+  SIMCONNECT_UNIT_QUANTITY_TEMPERATURE,
+  SIMCONNECT_UNIT_QUANTITY_PRESSURE,
+  SIMCONNECT_UNIT_QUANTITY_MASS,
+  SIMCONNECT_UNIT_QUANTITY_TIME,
+  SIMCONNECT_UNIT_QUANTITY_FREQUENCY,
+  SIMCONNECT_UNIT_QUANTITY_FORCE,
+  SIMCONNECT_UNIT_QUANTITY_TORQUE,
+  SIMCONNECT_UNIT_QUANTITY_POWER,
+  SIMCONNECT_UNIT_QUANTITY_MASS_FLOW,
+  SIMCONNECT_UNIT_QUANTITY_VOLUME_FLOW,
+  SIMCONNECT_UNIT_QUANTITY_DENSITY,
+};
+
+struct SimConnectUnitConversion {
+  // target = source * scale + offset
+  double scale = 1.0;
+  double offset = 0.0;
+};
+
+class SimConnectUnit;
+}
+
+class simconnect::toolbox::connection::SimConnectUnit {
+ public:
+  SimConnectUnit() = delete;
+
+  ~SimConnectUnit() = delete;
+
+  static constexpr bool isKnown(
+      std::string_view name
+  ) {
+    return find(name) != nullptr;
+  }
+
+  static constexpr SIMCONNECT_UNIT_QUANTITY getQuantity(
+      std::string_view name
+  ) {
+    const Entry *entry = find(name);
+    return entry != nullptr ? entry->quantity : SIMCONNECT_UNIT_QUANTITY_INVALID;
+  }
+
+  static constexpr std::string_view getCanonicalName(
+      std::string_view name
+  ) {
+    // aliases share quantity and conversion, the first entry is the name used towards SimConnect
+    const Entry *entry = find(name);
+    if (entry == nullptr || entry->quantity == SIMCONNECT_UNIT_QUANTITY_NONE) {
+      return name;
+    }
+    for (const auto &other : UNITS) {
+      if (other.quantity == entry->quantity && other.scale == entry->scale && other.offset == entry->offset) {
+        return other.name;
+      }
+    }
+    return name;
+  }
+
+  static constexpr bool isConvertible(
+      std::string_view from,
+      std::string_view to
+  ) {
+    // units without a physical quantity are only convertible to themselves
+    SIMCONNECT_UNIT_QUANTITY quantity = getQuantity(from);
+    if (quantity == SIMCONNECT_UNIT_QUANTITY_INVALID || quantity != getQuantity(to)) {
+      return false;
+    }
+    return quantity != SIMCONNECT_UNIT_QUANTITY_NONE || from == to;
+  }
+
+  static constexpr SimConnectUnitConversion getConversion(
+      std::string_view from,
+      std::string_view to
+  ) {
+    if (!isConvertible(from, to)) {
+      throw std::invalid_argument("Units are not convertible!");
+    }
+
+    // both units are converted through the canonical unit of the quantity
+    const Entry *source = find(from);
+    const Entry *target = find(to);
+    return {
+        source->scale / target->scale,
+        (source->offset - target->offset) / target->scale
+    };
+  }
+
+ private:
+  struct Entry {
+    std::string_view name;
+    SIMCONNECT_UNIT_QUANTITY quantity;
+    // canonical = value * scale + offset
+    double scale;
+    double offset;
+  };
+
+  static constexpr const Entry *find(
+      std::string_view name
+  ) {
+    for (const auto &entry : UNITS) {
+      if (entry.name == name) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  inline static constexpr double PI = 3.14159265358979323846;
+
+  inline static constexpr Entry UNITS[] = {
+      // no physical quantity, passed to SimConnect as is
+      {"BOOL", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"BOOLEAN", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"NUMBER", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"NUMBERS", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"ENUM", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"MASK", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"FLAGS", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"BCO16", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"BCD16", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"BCD32", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"FREQUENCY BCD16", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"FREQUENCY BCD32", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"FREQUENCY ADF BCD32", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"POSITION", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"POSITION 16K", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"POSITION 32K", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"POSITION 128", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"STRUCT", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"STRING", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"MACH", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"VOLT", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"VOLTS", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"AMPERE", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"AMPERES", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"AMPS", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"KEYFRAME", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"KEYFRAMES", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      {"SECONDS SINCE MIDNIGHT", SIMCONNECT_UNIT_QUANTITY_NONE, 1.0, 0.0},
+      // ratio, canonical unit is PERCENT OVER 100
+      {"PERCENT OVER 100", SIMCONNECT_UNIT_QUANTITY_RATIO, 1.0, 0.0},
+      {"PERCENT", SIMCONNECT_UNIT_QUANTITY_RATIO, 0.01, 0.0},
+      {"PERCENTAGE", SIMCONNECT_UNIT_QUANTITY_RATIO, 0.01, 0.0},
+      {"RATIO", SIMCONNECT_UNIT_QUANTITY_RATIO, 1.0, 0.0},
+      {"PART", SIMCONNECT_UNIT_QUANTITY_RATIO, 1.0, 0.0},
+      // length, canonical unit is METERS
+      {"METERS", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1.0, 0.0},
+      {"METER", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1.0, 0.0},
+      {"M", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1.0, 0.0},
+      {"CENTIMETERS", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.01, 0.0},
+      {"CENTIMETER", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.01, 0.0},
+      {"CM", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.01, 0.0},
+      {"MILLIMETERS", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.001, 0.0},
+      {"MILLIMETER", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.001, 0.0},
+      {"MM", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.001, 0.0},
+      {"KILOMETERS", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1000.0, 0.0},
+      {"KILOMETER", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1000.0, 0.0},
+      {"KM", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1000.0, 0.0},
+      {"FEET", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.3048, 0.0},
+      {"FOOT", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.3048, 0.0},
+      {"FT", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.3048, 0.0},
+      {"THOUSANDS OF FEET", SIMCONNECT_UNIT_QUANTITY_LENGTH, 304.8, 0.0},
+      {"INCHES", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.0254, 0.0},
+      {"INCH", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.0254, 0.0},
+      {"IN", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.0254, 0.0},
+      {"YARDS", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.9144, 0.0},
+      {"YARD", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.9144, 0.0},
+      {"YD", SIMCONNECT_UNIT_QUANTITY_LENGTH, 0.9144, 0.0},
+      {"MILES", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1609.344, 0.0},
+      {"MILE", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1609.344, 0.0},
+      {"NAUTICAL MILES", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1852.0, 0.0},
+      {"NAUTICAL MILE", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1852.0, 0.0},
+      {"NMILES", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1852.0, 0.0},
+      {"NMILE", SIMCONNECT_UNIT_QUANTITY_LENGTH, 1852.0, 0.0},
+      // area, canonical unit is SQUARE METERS
+      {"SQUARE METERS", SIMCONNECT_UNIT_QUANTITY_AREA, 1.0, 0.0},
+      {"SQUARE METER", SIMCONNECT_UNIT_QUANTITY_AREA, 1.0, 0.0},
+      {"SQUARE CENTIMETERS", SIMCONNECT_UNIT_QUANTITY_AREA, 0.0001, 0.0},
+      {"SQUARE CENTIMETER", SIMCONNECT_UNIT_QUANTITY_AREA, 0.0001, 0.0},
+      {"SQUARE KILOMETERS", SIMCONNECT_UNIT_QUANTITY_AREA, 1000000.0, 0.0},
+      {"SQUARE KILOMETER", SIMCONNECT_UNIT_QUANTITY_AREA, 1000000.0, 0.0},
+      {"SQUARE FEET", SIMCONNECT_UNIT_QUANTITY_AREA, 0.09290304, 0.0},
+      {"SQUARE FOOT", SIMCONNECT_UNIT_QUANTITY_AREA, 0.09290304, 0.0},
+      {"SQUARE INCHES", SIMCONNECT_UNIT_QUANTITY_AREA, 0.00064516, 0.0},
+      {"SQUARE INCH", SIMCONNECT_UNIT_QUANTITY_AREA, 0.00064516, 0.0},
+      {"SQUARE YARDS", SIMCONNECT_UNIT_QUANTITY_AREA, 0.83612736, 0.0},
+      {"SQUARE YARD", SIMCONNECT_UNIT_QUANTITY_AREA, 0.83612736, 0.0},
+      {"SQUARE MILES", SIMCONNECT_UNIT_QUANTITY_AREA, 2589988.110336, 0.0},
+      {"SQUARE MILE", SIMCONNECT_UNIT_QUANTITY_AREA, 2589988.110336, 0.0},
+      // volume, canonical unit is CUBIC METERS
+      {"CUBIC METERS", SIMCONNECT_UNIT_QUANTITY_VOLUME, 1.0, 0.0},
+      {"CUBIC METER", SIMCONNECT_UNIT_QUANTITY_VOLUME, 1.0, 0.0},
+      {"CUBIC CENTIMETERS", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.000001, 0.0},
+      {"CUBIC CENTIMETER", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.000001, 0.0},
+      {"CUBIC FEET", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.028316846592, 0.0},
+      {"CUBIC FOOT", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.028316846592, 0.0},
+      {"CUBIC INCHES", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.000016387064, 0.0},
+      {"CUBIC INCH", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.000016387064, 0.0},
+      {"CUBIC YARDS", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.764554857984, 0.0},
+      {"CUBIC YARD", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.764554857984, 0.0},
+      {"LITERS", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.001, 0.0},
+      {"LITER", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.001, 0.0},
+      {"GALLONS", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.003785411784, 0.0},
+      {"GALLON", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.003785411784, 0.0},
+      {"QUARTS", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.000946352946, 0.0},
+      {"QUART", SIMCONNECT_UNIT_QUANTITY_VOLUME, 0.000946352946, 0.0},
+      // speed, canonical unit is METERS PER SECOND
+      {"METERS PER SECOND", SIMCONNECT_UNIT_QUANTITY_SPEED, 1.0, 0.0},
+      {"METER PER SECOND", SIMCONNECT_UNIT_QUANTITY_SPEED, 1.0, 0.0},
+      {"M/S", SIMCONNECT_UNIT_QUANTITY_SPEED, 1.0, 0.0},
+      {"METERS PER MINUTE", SIMCONNECT_UNIT_QUANTITY_SPEED, 1.0 / 60.0, 0.0},
+      {"METER PER MINUTE", SIMCONNECT_UNIT_QUANTITY_SPEED, 1.0 / 60.0, 0.0},
+      {"KNOTS", SIMCONNECT_UNIT_QUANTITY_SPEED, 1852.0 / 3600.0, 0.0},
+      {"KNOT", SIMCONNECT_UNIT_QUANTITY_SPEED, 1852.0 / 3600.0, 0.0},
+      {"KTS", SIMCONNECT_UNIT_QUANTITY_SPEED, 1852.0 / 3600.0, 0.0},
+      {"KT", SIMCONNECT_UNIT_QUANTITY_SPEED, 1852.0 / 3600.0, 0.0},
+      {"FEET PER SECOND", SIMCONNECT_UNIT_QUANTITY_SPEED, 0.3048, 0.0},
+      {"FOOT PER SECOND", SIMCONNECT_UNIT_QUANTITY_SPEED, 0.3048, 0.0},
+      {"FT/S", SIMCONNECT_UNIT_QUANTITY_SPEED, 0.3048, 0.0},
+      {"FEET PER MINUTE", SIMCONNECT_UNIT_QUANTITY_SPEED, 0.3048 / 60.0, 0.0},
+      {"FOOT PER MINUTE", SIMCONNECT_UNIT_QUANTITY_SPEED, 0.3048 / 60.0, 0.0},
+      {"FT/MIN", SIMCONNECT_UNIT_QUANTITY_SPEED, 0.3048 / 60.0, 0.0},
+      {"KILOMETERS PER HOUR", SIMCONNECT_UNIT_QUANTITY_SPEED, 1.0 / 3.6, 0.0},
+      {"KILOMETER PER HOUR", SIMCONNECT_UNIT_QUANTITY_SPEED, 1.0 / 3.6, 0.0},
+      {"KPH", SIMCONNECT_UNIT_QUANTITY_SPEED, 1.0 / 3.6, 0.0},
+      {"MILES PER HOUR", SIMCONNECT_UNIT_QUANTITY_SPEED, 0.44704, 0.0},
+      {"MILE PER HOUR", SIMCONNECT_UNIT_QUANTITY_SPEED, 0.44704, 0.0},
+      {"MPH", SIMCONNECT_UNIT_QUANTITY_SPEED, 0.44704, 0.0},
+      // acceleration, canonical unit is METERS PER SECOND SQUARED
+      {"METERS PER SECOND SQUARED", SIMCONNECT_UNIT_QUANTITY_ACCELERATION, 1.0, 0.0},
+      {"METER PER SECOND SQUARED", SIMCONNECT_UNIT_QUANTITY_ACCELERATION, 1.0, 0.0},
+      {"FEET PER SECOND SQUARED", SIMCONNECT_UNIT_QUANTITY_ACCELERATION, 0.3048, 0.0},
+      {"FOOT PER SECOND SQUARED", SIMCONNECT_UNIT_QUANTITY_ACCELERATION, 0.3048, 0.0},
+      {"GFORCE", SIMCONNECT_UNIT_QUANTITY_ACCELERATION, 9.80665, 0.0},
+      // angle, canonical unit is RADIANS
+      {"RADIANS", SIMCONNECT_UNIT_QUANTITY_ANGLE, 1.0, 0.0},
+      {"RADIAN", SIMCONNECT_UNIT_QUANTITY_ANGLE, 1.0, 0.0},
+      {"RAD", SIMCONNECT_UNIT_QUANTITY_ANGLE, 1.0, 0.0},
+      {"DEGREES", SIMCONNECT_UNIT_QUANTITY_ANGLE, PI / 180.0, 0.0},
+      {"DEGREE", SIMCONNECT_UNIT_QUANTITY_ANGLE, PI / 180.0, 0.0},
+      {"DEG", SIMCONNECT_UNIT_QUANTITY_ANGLE, PI / 180.0, 0.0},
+      {"DEGREES LATITUDE", SIMCONNECT_UNIT_QUANTITY_ANGLE, PI / 180.0, 0.0},
+      {"DEGREE LATITUDE", SIMCONNECT_UNIT_QUANTITY_ANGLE, PI / 180.0, 0.0},
+      {"DEGREES LONGITUDE", SIMCONNECT_UNIT_QUANTITY_ANGLE, PI / 180.0, 0.0},
+      {"DEGREE LONGITUDE", SIMCONNECT_UNIT_QUANTITY_ANGLE, PI / 180.0, 0.0},
+      {"GRADS", SIMCONNECT_UNIT_QUANTITY_ANGLE, PI / 200.0, 0.0},
+      {"GRAD", SIMCONNECT_UNIT_QUANTITY_ANGLE, PI / 200.0, 0.0},
+      // angular velocity, canonical unit is RADIANS PER SECOND
+      {"RADIANS PER SECOND", SIMCONNECT_UNIT_QUANTITY_ANGULAR_VELOCITY, 1.0, 0.0},
+      {"RADIAN PER SECOND", SIMCONNECT_UNIT_QUANTITY_ANGULAR_VELOCITY, 1.0, 0.0},
+      {"DEGREES PER SECOND", SIMCONNECT_UNIT_QUANTITY_ANGULAR_VELOCITY, PI / 180.0, 0.0},
+      {"DEGREE PER SECOND", SIMCONNECT_UNIT_QUANTITY_ANGULAR_VELOCITY, PI / 180.0, 0.0},
+      {"RPM", SIMCONNECT_UNIT_QUANTITY_ANGULAR_VELOCITY, PI / 30.0, 0.0},
+      {"RPMS", SIMCONNECT_UNIT_QUANTITY_ANGULAR_VELOCITY, PI / 30.0, 0.0},
+      {"REVOLUTIONS PER MINUTE", SIMCONNECT_UNIT_QUANTITY_ANGULAR_VELOCITY, PI / 30.0, 0.0},
+      // angular acceleration, canonical unit is RADIANS PER SECOND SQUARED
+      {"RADIANS PER SECOND SQUARED", SIMCONNECT_UNIT_QUANTITY_ANGULAR_ACCELERATION, 1.0, 0.0},
+      {"RADIAN PER SECOND SQUARED", SIMCONNECT_UNIT_QUANTITY_ANGULAR_ACCELERATION, 1.0, 0.0},
+      {"DEGREES PER SECOND SQUARED", SIMCONNECT_UNIT_QUANTITY_ANGULAR_ACCELERATION, PI / 180.0, 0.0},
+      {"DEGREE PER SECOND SQUARED", SIMCONNECT_UNIT_QUANTITY_ANGULAR_ACCELERATION, PI / 180.0, 0.0},
+      // temperature, canonical unit is CELSIUS
+      {"CELSIUS", SIMCONNECT_UNIT_QUANTITY_TEMPERATURE, 1.0, 0.0},
+      {"KELVIN", SIMCONNECT_UNIT_QUANTITY_TEMPERATURE, 1.0, -273.15},
+      {"FAHRENHEIT", SIMCONNECT_UNIT_QUANTITY_TEMPERATURE, 5.0 / 9.0, -160.0 / 9.0},
+      {"RANKINE", SIMCONNECT_UNIT_QUANTITY_TEMPERATURE, 5.0 / 9.0, -273.15},
+      // pressure, canonical unit is PASCALS
+      {"PASCALS", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 1.0, 0.0},
+      {"PASCAL", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 1.0, 0.0},
+      {"PA", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 1.0, 0.0},
+      {"MILLIBARS", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 100.0, 0.0},
+      {"MILLIBAR", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 100.0, 0.0},
+      {"MBAR", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 100.0, 0.0},
+      {"HECTOPASCALS", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 100.0, 0.0},
+      {"HECTOPASCAL", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 100.0, 0.0},
+      {"HPA", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 100.0, 0.0},
+      {"KILOPASCALS", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 1000.0, 0.0},
+      {"KILOPASCAL", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 1000.0, 0.0},
+      {"KPA", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 1000.0, 0.0},
+      {"BARS", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 100000.0, 0.0},
+      {"BAR", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 100000.0, 0.0},
+      {"ATMOSPHERES", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 101325.0, 0.0},
+      {"ATMOSPHERE", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 101325.0, 0.0},
+      {"ATM", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 101325.0, 0.0},
+      {"INCHES OF MERCURY", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 3386.389, 0.0},
+      {"INCH OF MERCURY", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 3386.389, 0.0},
+      {"INHG", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 3386.389, 0.0},
+      {"MILLIMETERS OF MERCURY", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 133.322387415, 0.0},
+      {"MILLIMETER OF MERCURY", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 133.322387415, 0.0},
+      {"MMHG", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 133.322387415, 0.0},
+      {"POUNDS PER SQUARE INCH", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 6894.757293168, 0.0},
+      {"POUND PER SQUARE INCH", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 6894.757293168, 0.0},
+      {"PSI", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 6894.757293168, 0.0},
+      {"POUNDS PER SQUARE FOOT", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 47.88025898, 0.0},
+      {"POUND PER SQUARE FOOT", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 47.88025898, 0.0},
+      {"PSF", SIMCONNECT_UNIT_QUANTITY_PRESSURE, 47.88025898, 0.0},
+      // mass, canonical unit is KILOGRAMS
+      {"KILOGRAMS", SIMCONNECT_UNIT_QUANTITY_MASS, 1.0, 0.0},
+      {"KILOGRAM", SIMCONNECT_UNIT_QUANTITY_MASS, 1.0, 0.0},
+      {"KG", SIMCONNECT_UNIT_QUANTITY_MASS, 1.0, 0.0},
+      {"GRAMS", SIMCONNECT_UNIT_QUANTITY_MASS, 0.001, 0.0},
+      {"GRAM", SIMCONNECT_UNIT_QUANTITY_MASS, 0.001, 0.0},
+      {"POUNDS", SIMCONNECT_UNIT_QUANTITY_MASS, 0.45359237, 0.0},
+      {"POUND", SIMCONNECT_UNIT_QUANTITY_MASS, 0.45359237, 0.0},
+      {"LBS", SIMCONNECT_UNIT_QUANTITY_MASS, 0.45359237, 0.0},
+      {"LB", SIMCONNECT_UNIT_QUANTITY_MASS, 0.45359237, 0.0},
+      {"SLUGS", SIMCONNECT_UNIT_QUANTITY_MASS, 14.59390294, 0.0},
+      {"SLUG", SIMCONNECT_UNIT_QUANTITY_MASS, 14.59390294, 0.0},
+      {"TONS", SIMCONNECT_UNIT_QUANTITY_MASS, 907.18474, 0.0},
+      {"TON", SIMCONNECT_UNIT_QUANTITY_MASS, 907.18474, 0.0},
+      {"METRIC TONS", SIMCONNECT_UNIT_QUANTITY_MASS, 1000.0, 0.0},
+      {"METRIC TON", SIMCONNECT_UNIT_QUANTITY_MASS, 1000.0, 0.0},
+      // time, canonical unit is SECONDS
+      {"SECONDS", SIMCONNECT_UNIT_QUANTITY_TIME, 1.0, 0.0},
+      {"SECOND", SIMCONNECT_UNIT_QUANTITY_TIME, 1.0, 0.0},
+      {"SEC", SIMCONNECT_UNIT_QUANTITY_TIME, 1.0, 0.0},
+      {"MILLISECONDS", SIMCONNECT_UNIT_QUANTITY_TIME, 0.001, 0.0},
+      {"MILLISECOND", SIMCONNECT_UNIT_QUANTITY_TIME, 0.001, 0.0},
+      {"MINUTES", SIMCONNECT_UNIT_QUANTITY_TIME, 60.0, 0.0},
+      {"MINUTE", SIMCONNECT_UNIT_QUANTITY_TIME, 60.0, 0.0},
+      {"MIN", SIMCONNECT_UNIT_QUANTITY_TIME, 60.0, 0.0},
+      {"HOURS", SIMCONNECT_UNIT_QUANTITY_TIME, 3600.0, 0.0},
+      {"HOUR", SIMCONNECT_UNIT_QUANTITY_TIME, 3600.0, 0.0},
+      {"HOURS OVER 10", SIMCONNECT_UNIT_QUANTITY_TIME, 360.0, 0.0},
+      {"DAYS", SIMCONNECT_UNIT_QUANTITY_TIME, 86400.0, 0.0},
+      {"DAY", SIMCONNECT_UNIT_QUANTITY_TIME, 86400.0, 0.0},
+      // frequency, canonical unit is HERTZ
+      {"HERTZ", SIMCONNECT_UNIT_QUANTITY_FREQUENCY, 1.0, 0.0},
+      {"HZ", SIMCONNECT_UNIT_QUANTITY_FREQUENCY, 1.0, 0.0},
+      {"KILOHERTZ", SIMCONNECT_UNIT_QUANTITY_FREQUENCY, 1000.0, 0.0},
+      {"KHZ", SIMCONNECT_UNIT_QUANTITY_FREQUENCY, 1000.0, 0.0},
+      {"MEGAHERTZ", SIMCONNECT_UNIT_QUANTITY_FREQUENCY, 1000000.0, 0.0},
+      {"MHZ", SIMCONNECT_UNIT_QUANTITY_FREQUENCY, 1000000.0, 0.0},
+      // force, canonical unit is NEWTONS
+      {"NEWTONS", SIMCONNECT_UNIT_QUANTITY_FORCE, 1.0, 0.0},
+      {"NEWTON", SIMCONNECT_UNIT_QUANTITY_FORCE, 1.0, 0.0},
+      {"POUNDS FORCE", SIMCONNECT_UNIT_QUANTITY_FORCE, 4.4482216152605, 0.0},
+      {"POUND FORCE", SIMCONNECT_UNIT_QUANTITY_FORCE, 4.4482216152605, 0.0},
+      {"LBF", SIMCONNECT_UNIT_QUANTITY_FORCE, 4.4482216152605, 0.0},
+      // torque, canonical unit is NEWTON METERS
+      {"NEWTON METERS", SIMCONNECT_UNIT_QUANTITY_TORQUE, 1.0, 0.0},
+      {"NEWTON METER", SIMCONNECT_UNIT_QUANTITY_TORQUE, 1.0, 0.0},
+      {"FOOT POUNDS", SIMCONNECT_UNIT_QUANTITY_TORQUE, 1.3558179483314, 0.0},
+      {"FOOT POUND", SIMCONNECT_UNIT_QUANTITY_TORQUE, 1.3558179483314, 0.0},
+      {"FOOT-POUNDS", SIMCONNECT_UNIT_QUANTITY_TORQUE, 1.3558179483314, 0.0},
+      {"FOOT-POUND", SIMCONNECT_UNIT_QUANTITY_TORQUE, 1.3558179483314, 0.0},
+      {"FT-LBS", SIMCONNECT_UNIT_QUANTITY_TORQUE, 1.3558179483314, 0.0},
+      // power, canonical unit is WATTS
+      {"WATTS", SIMCONNECT_UNIT_QUANTITY_POWER, 1.0, 0.0},
+      {"WATT", SIMCONNECT_UNIT_QUANTITY_POWER, 1.0, 0.0},
+      {"KILOWATTS", SIMCONNECT_UNIT_QUANTITY_POWER, 1000.0, 0.0},
+      {"KILOWATT", SIMCONNECT_UNIT_QUANTITY_POWER, 1000.0, 0.0},
+      {"KW", SIMCONNECT_UNIT_QUANTITY_POWER, 1000.0, 0.0},
+      {"HORSEPOWER", SIMCONNECT_UNIT_QUANTITY_POWER, 745.69987158227, 0.0},
+      {"HP", SIMCONNECT_UNIT_QUANTITY_POWER, 745.69987158227, 0.0},
+      {"FT LB PER SECOND", SIMCONNECT_UNIT_QUANTITY_POWER, 1.3558179483314, 0.0},
+      // mass flow, canonical unit is KILOGRAMS PER SECOND
+      {"KILOGRAMS PER SECOND", SIMCONNECT_UNIT_QUANTITY_MASS_FLOW, 1.0, 0.0},
+      {"KILOGRAM PER SECOND", SIMCONNECT_UNIT_QUANTITY_MASS_FLOW, 1.0, 0.0},
+      {"KILOGRAMS PER HOUR", SIMCONNECT_UNIT_QUANTITY_MASS_FLOW, 1.0 / 3600.0, 0.0},
+      {"KILOGRAM PER HOUR", SIMCONNECT_UNIT_QUANTITY_MASS_FLOW, 1.0 / 3600.0, 0.0},
+      {"POUNDS PER HOUR", SIMCONNECT_UNIT_QUANTITY_MASS_FLOW, 0.45359237 / 3600.0, 0.0},
+      {"POUND PER HOUR", SIMCONNECT_UNIT_QUANTITY_MASS_FLOW, 0.45359237 / 3600.0, 0.0},
+      {"PPH", SIMCONNECT_UNIT_QUANTITY_MASS_FLOW, 0.45359237 / 3600.0, 0.0},
+      // volume flow, canonical unit is CUBIC METERS PER SECOND
+      {"CUBIC METERS PER SECOND", SIMCONNECT_UNIT_QUANTITY_VOLUME_FLOW, 1.0, 0.0},
+      {"CUBIC METER PER SECOND", SIMCONNECT_UNIT_QUANTITY_VOLUME_FLOW, 1.0, 0.0},
+      {"LITERS PER HOUR", SIMCONNECT_UNIT_QUANTITY_VOLUME_FLOW, 0.001 / 3600.0, 0.0},
+      {"LITER PER HOUR", SIMCONNECT_UNIT_QUANTITY_VOLUME_FLOW, 0.001 / 3600.0, 0.0},
+      {"GALLONS PER HOUR", SIMCONNECT_UNIT_QUANTITY_VOLUME_FLOW, 0.003785411784 / 3600.0, 0.0},
+      {"GALLON PER HOUR", SIMCONNECT_UNIT_QUANTITY_VOLUME_FLOW, 0.003785411784 / 3600.0, 0.0},
+      {"GPH", SIMCONNECT_UNIT_QUANTITY_VOLUME_FLOW, 0.003785411784 / 3600.0, 0.0},
+      // density, canonical unit is KILOGRAMS PER CUBIC METER
+      {"KILOGRAMS PER CUBIC METER", SIMCONNECT_UNIT_QUANTITY_DENSITY, 1.0, 0.0},
+      {"KILOGRAM PER CUBIC METER", SIMCONNECT_UNIT_QUANTITY_DENSITY, 1.0, 0.0},
+      {"SLUGS PER CUBIC FEET", SIMCONNECT_UNIT_QUANTITY_DENSITY, 515.378818, 0.0},
+      {"SLUGS PER CUBIC FOOT", SIMCONNECT_UNIT_QUANTITY_DENSITY, 515.378818, 0.0},
+      {"SLUG PER CUBIC FOOT", SIMCONNECT_UNIT_QUANTITY_DENSITY, 515.378818, 0.0},
+      {"POUNDS PER GALLON", SIMCONNECT_UNIT_QUANTITY_DENSITY, 119.826427, 0.0},
+      {"POUND PER GALLON", SIMCONNECT_UNIT_QUANTITY_DENSITY, 119.826427, 0.0},
+  };
+};
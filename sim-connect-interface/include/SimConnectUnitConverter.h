@@ -0,0 +1,51 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <vector>
+#include "SimConnectUnit.h"
+
+namespace simconnect::toolbox::connection {
+class SimConnectUnitConverter;
+}
+
+class simconnect::toolbox::connection::SimConnectUnitConverter {
+ public:
+  SimConnectUnitConverter() = default;
+
+  ~SimConnectUnitConverter() = default;
+
+  size_t add(
+      size_t sourceIndex,
+      SimConnectUnitConversion conversion
+  );
+
+  void clear();
+
+  [[nodiscard]] size_t size() const;
+
+  void convert(
+      const double *source,
+      double *target
+  ) const;
+
+ private:
+  // structure of arrays, so that the conversion runs as one affine kernel over all values
+  std::vector<size_t> sourceIndices;
+  std::vector<double> scales;
+  std::vector<double> offsets;
+};
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#pragma once
+
+#include <any>
+#include <array>
+#include <string>
+#include <vector>
+#include "SimConnectData.h"
+#include "SimConnectDataDefinition.h"
+
+namespace simconnect::toolbox::connection {
+class SimConnectUpdateRateScheduler;
+}
+
+class simconnect::toolbox::connection::SimConnectUpdateRateScheduler {
+ public:
+  struct Configuration {
+    // slow variables are requested every n-th step (latency bound)
+    size_t slowInterval = 10;
+    // maximum expected change of a slow variable between two requests relative to the largest magnitude seen, used
+    // for adaptive variables without an error bound in their unit
+    double relativeErrorBound = 0.01;
+    // number of frames between two partitions
+    size_t partitionPeriod = 100;
+    // smoothing factor of rate and noise estimation
+    double smoothing = 0.1;
+  };
+
+  explicit SimConnectUpdateRateScheduler(
+      const Configuration &configuration
+  );
+
+  ~SimConnectUpdateRateScheduler() = default;
+
+  void reset(
+      size_t count
+  );
+
+  bool update(
+      SimConnectDataDefinition &dataDefinition,
+      SimConnectData &data
+  );
+
+  [[nodiscard]] const std::vector<size_t> &getIntervals() const;
+
+  inline const static std::string REQUESTED_SIZE_VARIABLE = "FRAME REQUESTED BYTES";
+
+ private:
+  struct VariableState {
+    std::array<double, 3> value = {};
+    bool hasValue = false;
+    size_t framesSinceValue = 0;
+    double rate = 0;
+    double noise = 0;
+    double magnitude = 0;
+  };
+
+  Configuration configuration;
+  std::vector<VariableState> states;
+  std::vector<size_t> intervals;
+  size_t frameCount = 0;
+
+  void observe(
+      VariableState &state,
+      const std::array<double, 3> &value,
+      size_t interval
+  ) const;
+
+  [[nodiscard]] size_t getInterval(
+      const VariableState &state,
+      size_t interval,
+      double errorBound
+  ) const;
+
+  static std::array<double, 3> getValue(
+      SIMCONNECT_VARIABLE_TYPE type,
+      const std::any &value
+  );
+};
@@ -19,8 +19,34 @@
 #include <algorithm>
 #include <string>
 #include <utility>
+#include <Windows.h>
+#include <SimConnect.h>
+#include "SimConnectString.h"
+#include "SimConnectVariableType.h"
 
 namespace simconnect::toolbox::connection {
+
+enum SIMCONNECT_VARIABLE_PRIORITY {
+  SIMCONNECT_VARIABLE_PRIORITY_HIGH,
+  SIMCONNECT_VARIABLE_PRIORITY_NORMAL,
+  SIMCONNECT_VARIABLE_PRIORITY_LOW,
+};
+
+enum SIMCONNECT_VARIABLE_TRIGGER {
+  SIMCONNECT_VARIABLE_TRIGGER_NONE,
+  SIMCONNECT_VARIABLE_TRIGGER_CHANGED,
+  SIMCONNECT_VARIABLE_TRIGGER_CROSSED,
+  SIMCONNECT_VARIABLE_TRIGGER_DEADBAND,
+};
+
+enum SIMCONNECT_VARIABLE_FILTER {
+  SIMCONNECT_VARIABLE_FILTER_NONE,
+  SIMCONNECT_VARIABLE_FILTER_LOWPASS,
+  SIMCONNECT_VARIABLE_FILTER_LOWPASS2,
+  SIMCONNECT_VARIABLE_FILTER_AVERAGE,
+  SIMCONNECT_VARIABLE_FILTER_DERIVATIVE,
+};
+
 class SimConnectVariable;
 }
 
@@ -29,13 +55,58 @@ class simconnect::toolbox::connection::SimConnectVariable {
   SimConnectVariable(
       std::string name,
       std::string unit
-  ) : name(move(name)), unit(move(unit)) {
-    transform(this->name.begin(), this->name.end(), this->name.begin(), ::toupper);
-    transform(this->unit.begin(), this->unit.end(), this->unit.begin(), ::toupper);
+  ) : name(toUpper(move(name))), unit(toUpper(move(unit))) {
   }
 
   ~SimConnectVariable() = default;
 
-  std::string name;
-  std::string unit;
+  bool operator==(
+      const SimConnectVariable &other
+  ) const {
+    return name == other.name
+        && unit == other.unit
+        && isStatic == other.isStatic
+        && priority == other.priority
+        && type == other.type
+        && trigger == other.trigger
+        && triggerThreshold == other.triggerThreshold
+        && isHold == other.isHold
+        && filter == other.filter
+        && filterParameter == other.filterParameter
+        && isAdaptive == other.isAdaptive
+        && adaptiveErrorBound == other.adaptiveErrorBound;
+  }
+
+  bool operator!=(
+      const SimConnectVariable &other
+  ) const {
+    return !(*this == other);
+  }
+
+  SimConnectString name;
+  SimConnectString unit;
+  bool isStatic = false;
+  SIMCONNECT_VARIABLE_PRIORITY priority = SIMCONNECT_VARIABLE_PRIORITY_NORMAL;
+  // explicit type of the variable, takes precedence over the variable registry
+  SIMCONNECT_VARIABLE_TYPE type = SIMCONNECT_VARIABLE_TYPE_INVALID;
+  // condition reported as trigger instead of the value, the threshold is the deadband for deadband triggers
+  SIMCONNECT_VARIABLE_TRIGGER trigger = SIMCONNECT_VARIABLE_TRIGGER_NONE;
+  double triggerThreshold = 0;
+  // the value is not written to the port while the received frames are unchanged
+  bool isHold = false;
+  // filter applied to the value, the parameter is the time constant in seconds or the window in frames
+  SIMCONNECT_VARIABLE_FILTER filter = SIMCONNECT_VARIABLE_FILTER_NONE;
+  double filterParameter = 0;
+  // the variable is requested less often while it changes slowly, the error bound is given in its unit
+  bool isAdaptive = false;
+  double adaptiveErrorBound = 0;
+
+ private:
+  static SimConnectString toUpper(
+      std::string value
+  ) {
+    // names and units are interned in upper case
+    transform(value.begin(), value.end(), value.begin(), ::toupper);
+    return SimConnectString(value);
+  }
 };
@@ -16,8 +16,15 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <Windows.h>
 #include <SimConnect.h>
 #include "SimConnectVariable.h"
@@ -45,14 +52,95 @@ class simconnect::toolbox::connection::SimConnectVariableLookupTable {
       const SimConnectVariable &item
   );
 
+  static bool isStatic(
+      const SimConnectVariable &item
+  );
+
+  static void registerVariable(
+      const std::string &name,
+      SIMCONNECT_VARIABLE_TYPE type,
+      bool isStatic = false
+  );
+
+  static bool loadRegistryFile(
+      const std::string &path
+  );
+
+  inline static const std::string REGISTRY_FILE_ENVIRONMENT_VARIABLE = "SIMCONNECT_TOOLBOX_VARIABLE_REGISTRY";
+  inline static const std::string LOCAL_VARIABLE_PREFIX = "L:";
+
+  static constexpr SIMCONNECT_VARIABLE_TYPE lookupDataType(
+      std::string_view name
+  ) {
+    // compile time variant of getDataType() for upper case names
+    for (const auto &[entryName, type] : LOOKUP_ENTRIES) {
+      if (entryName == name) {
+        return type;
+      }
+      // indexed variables are listed as NAME:index
+      if (entryName.size() > INDEX_SUFFIX.size()
+          && entryName.substr(entryName.size() - INDEX_SUFFIX.size()) == INDEX_SUFFIX) {
+        auto prefix = entryName.substr(0, entryName.size() - INDEX_SUFFIX.size() + 1);
+        if (name.size() > prefix.size() && name.substr(0, prefix.size()) == prefix && isNumber(name.substr(prefix.size()))) {
+          return type;
+        }
+      }
+    }
+    return SIMCONNECT_VARIABLE_TYPE_INVALID;
+  }
+
  private:
   SimConnectVariableLookupTable() = default;
 
   ~SimConnectVariableLookupTable() = default;
 
+  struct Entry {
+    bool isKnown = false;
+    bool isStatic = false;
+    SIMCONNECT_VARIABLE_TYPE type = SIMCONNECT_VARIABLE_TYPE_INVALID;
+  };
+
   static std::string normalizeName(const std::string& itemName);
 
-  inline static const std::map<std::string, SIMCONNECT_VARIABLE_TYPE> LOOKUP_TABLE = {
+  static constexpr bool isNumber(
+      std::string_view value
+  ) {
+    for (auto character : value) {
+      if (character < '0' || character > '9') {
+        return false;
+      }
+    }
+    return !value.empty();
+  }
+
+  inline static constexpr std::string_view INDEX_SUFFIX = ":index";
+
+  static Entry resolve(
+      const SimConnectVariable &item
+  );
+
+  static Entry resolveName(
+      const SimConnectString &name
+  );
+
+  static void loadRegistryFileFromEnvironment();
+
+  static std::string toRegistryName(
+      std::string name
+  );
+
+  static void parseRegistry(
+      std::string_view content,
+      std::unordered_map<std::string, Entry> &entries
+  );
+
+  // resolved entries by interned name id and the entries of the user registry
+  inline static std::shared_mutex registryMutex;
+  inline static std::unordered_map<uint32_t, Entry> resolved;
+  inline static std::unordered_map<std::string, Entry> registered;
+  inline static std::once_flag registryLoaded;
+
+  inline static constexpr std::pair<std::string_view, SIMCONNECT_VARIABLE_TYPE> LOOKUP_ENTRIES[] = {
       {"AUTOPILOT PITCH HOLD", SIMCONNECT_VARIABLE_TYPE_BOOL},
       {"STRUCT AMBIENT WIND", SIMCONNECT_VARIABLE_TYPE_FLOAT64},
       {"LAUNCHBAR POSITION", SIMCONNECT_VARIABLE_TYPE_FLOAT64},
@@ -705,6 +793,13 @@ class simconnect::toolbox::connection::SimConnectVariableLookupTable {
       {"SIM DISABLED", SIMCONNECT_VARIABLE_TYPE_BOOL},
       {"G FORCE", SIMCONNECT_VARIABLE_TYPE_FLOAT64},
       {"ATC HEAVY", SIMCONNECT_VARIABLE_TYPE_BOOL},
+      {"ATC ID", SIMCONNECT_VARIABLE_TYPE_STRING32},
+      {"ATC AIRLINE", SIMCONNECT_VARIABLE_TYPE_STRING64},
+      {"ATC FLIGHT NUMBER", SIMCONNECT_VARIABLE_TYPE_STRING8},
+      {"ATC TYPE", SIMCONNECT_VARIABLE_TYPE_STRING64},
+      {"ATC MODEL", SIMCONNECT_VARIABLE_TYPE_STRING64},
+      {"TITLE", SIMCONNECT_VARIABLE_TYPE_STRING256},
+      {"CATEGORY", SIMCONNECT_VARIABLE_TYPE_STRING256},
       {"AUTO COORDINATION", SIMCONNECT_VARIABLE_TYPE_BOOL},
       {"REALISM", SIMCONNECT_VARIABLE_TYPE_FLOAT64},
       {"TRUE AIRSPEED SELECTED", SIMCONNECT_VARIABLE_TYPE_BOOL},
@@ -911,4 +1006,50 @@ class simconnect::toolbox::connection::SimConnectVariableLookupTable {
       {"AXIS_PROPELLER3_SET", SIMCONNECT_VARIABLE_TYPE_FLOAT64},
       {"AXIS_PROPELLER4_SET", SIMCONNECT_VARIABLE_TYPE_FLOAT64},
   };
+
+  inline static const std::unordered_map<std::string, SIMCONNECT_VARIABLE_TYPE> LOOKUP_TABLE = [] {
+    std::unordered_map<std::string, SIMCONNECT_VARIABLE_TYPE> table;
+    for (const auto &[name, type] : LOOKUP_ENTRIES) {
+      table.emplace(name, type);
+    }
+    return table;
+  }();
+
+  inline static const std::set<std::string> STATIC_LOOKUP_TABLE = {
+      "ATC HEAVY",
+      "ATC MODEL",
+      "ATC SUGGESTED MIN RWY LANDING",
+      "ATC SUGGESTED MIN RWY TAKEOFF",
+      "ATC TYPE",
+      "CATEGORY",
+      "CG AFT LIMIT",
+      "CG FWD LIMIT",
+      "CG MAX MACH",
+      "CG MIN MACH",
+      "DESIGN SPEED VC",
+      "DESIGN SPEED VS0",
+      "DESIGN SPEED VS1",
+      "EMPTY WEIGHT",
+      "EMPTY WEIGHT CROSS COUPLED MOI",
+      "EMPTY WEIGHT PITCH MOI",
+      "EMPTY WEIGHT ROLL MOI",
+      "EMPTY WEIGHT YAW MOI",
+      "ENGINE TYPE",
+      "ESTIMATED CRUISE SPEED",
+      "FLAPS NUM HANDLE POSITIONS",
+      "IS GEAR RETRACTABLE",
+      "IS TAIL DRAGGER",
+      "MAX GROSS WEIGHT",
+      "MAX RATED ENGINE RPM",
+      "NUM FUEL SELECTORS",
+      "NUMBER OF CATAPULTS",
+      "NUMBER OF ENGINES",
+      "RECIP ENG NUM CYLINDERS",
+      "STATIC CG TO GROUND",
+      "STATIC PITCH",
+      "TITLE",
+      "TYPICAL DESCENT RATE",
+      "WING AREA",
+      "WING SPAN",
+  };
 };
@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <vector>
 #include "SimConnectVariable.h"
 #include "SimConnectDataDefinition.h"
+#include "SimConnectUnit.h"
 
 namespace simconnect::toolbox::connection {
 class SimConnectVariableParser;
@@ -47,26 +49,77 @@ class simconnect::toolbox::connection::SimConnectVariableParser {
 
     simConnectVariables.reserve(lines.size());
     for (const auto &line : lines) {
-      simConnectVariables.emplace_back(getSimConnectVariableFromVariableLine(line));
+      auto lineVariables = getSimConnectVariablesFromVariableLine(line);
+      simConnectVariables.insert(simConnectVariables.end(), lineVariables.begin(), lineVariables.end());
     }
 
     // need to parse string
     return simConnectVariables;
   }
 
+  static std::vector<size_t> getPortSizesFromParameterString(
+      const std::string &parameter
+  ) {
+    // number of variables behind every port, a vector port holds a whole range
+    std::vector<size_t> portSizes;
+    for (const auto &line : getVariableLines(parameter)) {
+      std::vector<std::string> fields = getVariableFields(line);
+      if (fields.size() < 2) {
+        throw std::invalid_argument("Variable not valid!");
+      }
+
+      // get size of range
+      std::string prefix;
+      size_t first = 0;
+      size_t last = 0;
+      size_t count = getVariableRange(fields[0], prefix, first, last) ? last - first + 1 : 1;
+
+      // check if the range is a vector
+      bool isVector = false;
+      for (size_t index = 2; index < fields.size(); ++index) {
+        isVector |= isVectorOption(fields[index]);
+      }
+
+      // add ports
+      if (isVector) {
+        portSizes.push_back(count);
+      } else {
+        portSizes.insert(portSizes.end(), count, 1);
+      }
+    }
+
+    // return result
+    return portSizes;
+  }
+
+  static std::vector<std::string> getUnknownUnits(
+      const std::vector<SimConnectVariable> &variables
+  ) {
+    // units missing in the unit table are passed to SimConnect unchanged, they are only reported
+    std::vector<std::string> units;
+    for (const auto &variable : variables) {
+      auto unit = variable.unit.str();
+      if (!SimConnectUnit::isKnown(unit) && std::find(units.begin(), units.end(), unit) == units.end()) {
+        units.push_back(unit);
+      }
+    }
+    return units;
+  }
+
   static SimConnectDataDefinition getSimConnectDataDefinitionFromVariables(
       const std::vector<SimConnectVariable> &variables
   ) {
-    // create data definition
-    auto dataDefinition = SimConnectDataDefinition();
+    // create data definition, names and units are already interned by the variables
+    SimConnectDataDefinition::Builder builder;
+    builder.reserve(variables.size());
 
     // add variables
     for (const auto &variable : variables) {
-      dataDefinition.add(variable);
+      builder.add(variable);
     }
 
     // return data definition
-    return dataDefinition;
+    return builder.build();
   }
 
   static std::vector<std::string> getVariableLines(
@@ -90,29 +143,297 @@ class simconnect::toolbox::connection::SimConnectVariableParser {
   static SimConnectVariable getSimConnectVariableFromVariableLine(
       const std::string &line
   ) {
-    // find delimiter
+    // a single variable is expected
+    auto variables = getSimConnectVariablesFromVariableLine(line);
+    if (variables.size() != 1) {
+      throw std::invalid_argument("Variable range not allowed!");
+    }
+
+    // return result
+    return variables.front();
+  }
+
+  static std::vector<SimConnectVariable> getSimConnectVariablesFromVariableLine(
+      const std::string &line
+  ) {
+    // split line into name, unit and options
+    std::vector<std::string> fields = getVariableFields(line);
+    if (fields.size() < 2) {
+      throw std::invalid_argument("Variable not valid!");
+    }
+
+    // get names, a range of indices is expanded into one variable per index
+    std::vector<std::string> names;
+    std::string prefix;
+    size_t first = 0;
+    size_t last = 0;
+    if (getVariableRange(fields[0], prefix, first, last)) {
+      names.reserve(last - first + 1);
+      for (size_t index = first; index <= last; ++index) {
+        names.push_back(prefix + VARIABLE_INDEX_DELIMITER + std::to_string(index));
+      }
+    } else {
+      names.push_back(fields[0]);
+    }
+
+    // get variables from name and unit, all variables of a range share the options
+    std::vector<SimConnectVariable> variables;
+    variables.reserve(names.size());
+    for (const auto &name : names) {
+      SimConnectVariable variable(name, fields[1]);
+      for (size_t index = 2; index < fields.size(); ++index) {
+        applyVariableOption(variable, fields[index]);
+      }
+      variables.push_back(variable);
+    }
+
+    // return result
+    return variables;
+  }
+
+  static bool getVariableRange(
+      const std::string &name,
+      std::string &prefix,
+      size_t &first,
+      size_t &last
+  ) {
+    // range is given as NAME:first..last
+    size_t kIndex = name.rfind(VARIABLE_INDEX_DELIMITER);
+    if (kIndex == std::string::npos) {
+      return false;
+    }
+    std::string suffix = name.substr(kIndex + VARIABLE_INDEX_DELIMITER.length());
+    size_t kRange = suffix.find(VARIABLE_RANGE_DELIMITER);
+    if (kRange == std::string::npos) {
+      return false;
+    }
+
+    // get bounds of range
+    std::string firstString = suffix.substr(0, kRange);
+    std::string lastString = suffix.substr(kRange + VARIABLE_RANGE_DELIMITER.length());
+    trim(firstString);
+    trim(lastString);
+    if (!isNumber(firstString) || !isNumber(lastString)) {
+      throw std::invalid_argument("Variable range not valid!");
+    }
+    first = std::stoul(firstString);
+    last = std::stoul(lastString);
+    if (last < first || last - first + 1 > VARIABLE_RANGE_MAX_SIZE) {
+      throw std::invalid_argument("Variable range not valid!");
+    }
+
+    // get name without index
+    prefix = name.substr(0, kIndex);
+    trim(prefix);
+    return true;
+  }
+
+  static void applyVariableOption(
+      SimConnectVariable &variable,
+      const std::string &option
+  ) {
+    // split option into key and value
+    std::string key = option;
+    std::string value;
     size_t kPosition = 0;
-    if ((kPosition = line.find(VARIABLE_PARAMETER_DELIMITER)) != std::string::npos) {
-      // get name and unit
-      std::string name = line.substr(0, kPosition);
-      std::string unit = line.substr(kPosition + 1, std::string::npos);
+    if ((kPosition = option.find(VARIABLE_OPTION_DELIMITER)) != std::string::npos) {
+      key = option.substr(0, kPosition);
+      value = option.substr(kPosition + VARIABLE_OPTION_DELIMITER.length());
+    }
+    trim(key);
+    trim(value);
+    transform(key.begin(), key.end(), key.begin(), ::toupper);
+    transform(value.begin(), value.end(), value.begin(), ::toupper);
+
+    // apply option
+    if (key == VARIABLE_OPTION_STATIC && value.empty()) {
+      variable.isStatic = true;
+    } else if (key == VARIABLE_OPTION_VECTOR && value.empty()) {
+      // layout of the ports, does not change the variable
+    } else if (key == VARIABLE_OPTION_PRIORITY) {
+      variable.priority = getPriority(value);
+    } else if (key == VARIABLE_OPTION_TYPE) {
+      variable.type = SimConnectVariableType::fromName(value);
+      if (variable.type == SIMCONNECT_VARIABLE_TYPE_INVALID) {
+        throw std::invalid_argument("Variable type not known!");
+      }
+    } else if (key == VARIABLE_OPTION_TRIGGER) {
+      setTrigger(variable, value);
+    } else if (key == VARIABLE_OPTION_HOLD && value.empty()) {
+      variable.isHold = true;
+    } else if (key == VARIABLE_OPTION_FILTER) {
+      setFilter(variable, value);
+    } else if (key == VARIABLE_OPTION_ADAPTIVE) {
+      // without error bound the bound is relative to the magnitude of the variable
+      variable.isAdaptive = true;
+      variable.adaptiveErrorBound = value.empty() ? 0 : getNumber(value, "Variable error bound not valid!");
+      if (variable.adaptiveErrorBound < 0) {
+        throw std::invalid_argument("Variable error bound not valid!");
+      }
+    } else {
+      throw std::invalid_argument("Variable option not known!");
+    }
+  }
 
-      // trim them
+  static SIMCONNECT_VARIABLE_PRIORITY getPriority(
+      const std::string &value
+  ) {
+    if (value == "HIGH") {
+      return SIMCONNECT_VARIABLE_PRIORITY_HIGH;
+    } else if (value == "NORMAL") {
+      return SIMCONNECT_VARIABLE_PRIORITY_NORMAL;
+    } else if (value == "LOW") {
+      return SIMCONNECT_VARIABLE_PRIORITY_LOW;
+    }
+    throw std::invalid_argument("Variable priority not known!");
+  }
+
+  static void setTrigger(
+      SimConnectVariable &variable,
+      const std::string &value
+  ) {
+    // trigger is given as CHANGED, CROSSED:threshold or DEADBAND:width
+    std::string name = value;
+    std::string threshold;
+    size_t kPosition = value.find(VARIABLE_TRIGGER_DELIMITER);
+    if (kPosition != std::string::npos) {
+      name = value.substr(0, kPosition);
+      threshold = value.substr(kPosition + VARIABLE_TRIGGER_DELIMITER.length());
       trim(name);
-      trim(unit);
+      trim(threshold);
+    }
+
+    if (name == "CHANGED" && threshold.empty()) {
+      variable.trigger = SIMCONNECT_VARIABLE_TRIGGER_CHANGED;
+      variable.triggerThreshold = 0;
+      return;
+    } else if (name == "CROSSED" && !threshold.empty()) {
+      variable.trigger = SIMCONNECT_VARIABLE_TRIGGER_CROSSED;
+    } else if (name == "DEADBAND" && !threshold.empty()) {
+      variable.trigger = SIMCONNECT_VARIABLE_TRIGGER_DEADBAND;
+    } else {
+      throw std::invalid_argument("Variable trigger not known!");
+    }
+
+    variable.triggerThreshold = getNumber(threshold, "Variable trigger threshold not valid!");
+  }
+
+  static void setFilter(
+      SimConnectVariable &variable,
+      const std::string &value
+  ) {
+    // filter is given as LOWPASS:time constant, LOWPASS2:time constant, AVERAGE:window or DERIVATIVE
+    std::string name = value;
+    std::string parameter;
+    size_t kPosition = value.find(VARIABLE_FILTER_DELIMITER);
+    if (kPosition != std::string::npos) {
+      name = value.substr(0, kPosition);
+      parameter = value.substr(kPosition + VARIABLE_FILTER_DELIMITER.length());
+      trim(name);
+      trim(parameter);
+    }
+
+    if (name == "DERIVATIVE" && parameter.empty()) {
+      variable.filter = SIMCONNECT_VARIABLE_FILTER_DERIVATIVE;
+      variable.filterParameter = 0;
+      return;
+    } else if (name == "LOWPASS" && !parameter.empty()) {
+      variable.filter = SIMCONNECT_VARIABLE_FILTER_LOWPASS;
+    } else if (name == "LOWPASS2" && !parameter.empty()) {
+      variable.filter = SIMCONNECT_VARIABLE_FILTER_LOWPASS2;
+    } else if (name == "AVERAGE" && !parameter.empty()) {
+      variable.filter = SIMCONNECT_VARIABLE_FILTER_AVERAGE;
+    } else {
+      throw std::invalid_argument("Variable filter not known!");
+    }
+
+    // time constants are not negative, windows are a whole number of frames
+    variable.filterParameter = getNumber(parameter, "Variable filter parameter not valid!");
+    if (variable.filterParameter < 0
+        || (variable.filter == SIMCONNECT_VARIABLE_FILTER_AVERAGE
+            && (!isNumber(parameter) || variable.filterParameter < 1
+                || variable.filterParameter > VARIABLE_FILTER_MAX_WINDOW))) {
+      throw std::invalid_argument("Variable filter parameter not valid!");
+    }
+  }
 
-      // return result
-      return SimConnectVariable(name, unit);
+  static double getNumber(
+      const std::string &value,
+      const std::string &error
+  ) {
+    // the whole value has to be a number
+    size_t length = 0;
+    double result = 0;
+    try {
+      result = std::stod(value, &length);
+    } catch (std::exception &) {
+      length = 0;
     }
-    throw std::invalid_argument("Variable not valid!");
+    if (length != value.size()) {
+      throw std::invalid_argument(error);
+    }
+    return result;
+  }
+
+  static std::vector<std::string> getVariableFields(
+      const std::string &line
+  ) {
+    // result
+    std::vector<std::string> fields;
+
+    // iterate over line and add trimmed fields to result
+    size_t kStart = 0;
+    size_t kPosition = 0;
+    while ((kPosition = line.find(VARIABLE_PARAMETER_DELIMITER, kStart)) != std::string::npos) {
+      fields.push_back(line.substr(kStart, kPosition - kStart));
+      kStart = kPosition + VARIABLE_PARAMETER_DELIMITER.length();
+    }
+    fields.push_back(line.substr(kStart));
+    for (auto &field : fields) {
+      trim(field);
+    }
+
+    // return result
+    return fields;
   }
 
  private:
   inline const static std::string VARIABLE_DELIMITER = ";";
   inline const static std::string VARIABLE_PARAMETER_DELIMITER = ",";
+  inline const static std::string VARIABLE_OPTION_DELIMITER = "=";
+  inline const static std::string VARIABLE_OPTION_STATIC = "STATIC";
+  inline const static std::string VARIABLE_OPTION_PRIORITY = "PRIORITY";
+  inline const static std::string VARIABLE_OPTION_VECTOR = "VECTOR";
+  inline const static std::string VARIABLE_OPTION_TYPE = "TYPE";
+  inline const static std::string VARIABLE_OPTION_TRIGGER = "TRIGGER";
+  inline const static std::string VARIABLE_TRIGGER_DELIMITER = ":";
+  inline const static std::string VARIABLE_OPTION_HOLD = "HOLD";
+  inline const static std::string VARIABLE_OPTION_FILTER = "FILTER";
+  inline const static std::string VARIABLE_FILTER_DELIMITER = ":";
+  inline const static size_t VARIABLE_FILTER_MAX_WINDOW = 1024;
+  inline const static std::string VARIABLE_OPTION_ADAPTIVE = "ADAPTIVE";
+  inline const static std::string VARIABLE_INDEX_DELIMITER = ":";
+  inline const static std::string VARIABLE_RANGE_DELIMITER = "..";
+  inline const static size_t VARIABLE_RANGE_MAX_SIZE = 256;
 
   SimConnectVariableParser() = default;
 
+  static bool isVectorOption(
+      std::string option
+  ) {
+    trim(option);
+    transform(option.begin(), option.end(), option.begin(), ::toupper);
+    return option == VARIABLE_OPTION_VECTOR;
+  }
+
+  static bool isNumber(
+      const std::string &value
+  ) {
+    return !value.empty() && std::all_of(value.begin(), value.end(), [](unsigned char ch) {
+      return isdigit(ch);
+    });
+  }
+
   ~SimConnectVariableParser() = default;
 
   static inline void ltrim(
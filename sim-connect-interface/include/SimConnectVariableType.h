@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <string_view>
+
 namespace simconnect::toolbox::connection {
 
 enum SIMCONNECT_VARIABLE_TYPE {
@@ -26,6 +28,10 @@ enum SIMCONNECT_VARIABLE_TYPE {
   SIMCONNECT_VARIABLE_TYPE_FLOAT64,
   SIMCONNECT_VARIABLE_TYPE_LATLONALT,
   SIMCONNECT_VARIABLE_TYPE_XYZ,
+  SIMCONNECT_VARIABLE_TYPE_STRING8,
+  SIMCONNECT_VARIABLE_TYPE_STRING32,
+  SIMCONNECT_VARIABLE_TYPE_STRING64,
+  SIMCONNECT_VARIABLE_TYPE_STRING256,
 };
 
 class SimConnectVariableType {
@@ -34,6 +40,9 @@ class SimConnectVariableType {
 
   ~SimConnectVariableType() = delete;
 
+  // number of variable types including invalid, used to size arrays indexed by type
+  inline static constexpr size_t TYPE_COUNT = SIMCONNECT_VARIABLE_TYPE_STRING256 + 1;
+
   static bool isStruct(
       SIMCONNECT_VARIABLE_TYPE type
   ) {
@@ -48,6 +57,59 @@ class SimConnectVariableType {
     return false;
   }
 
+  static bool isString(
+      SIMCONNECT_VARIABLE_TYPE type
+  ) {
+    switch (type) {
+      case SIMCONNECT_VARIABLE_TYPE_STRING8:
+      case SIMCONNECT_VARIABLE_TYPE_STRING32:
+      case SIMCONNECT_VARIABLE_TYPE_STRING64:
+      case SIMCONNECT_VARIABLE_TYPE_STRING256:
+        return true;
+
+      default:
+        return false;
+    }
+  }
+
+  static size_t getSize(
+      SIMCONNECT_VARIABLE_TYPE type
+  ) {
+    switch (type) {
+      case SIMCONNECT_VARIABLE_TYPE_BOOL:
+      case SIMCONNECT_VARIABLE_TYPE_INT32:
+        return sizeof(int);
+
+      case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
+        return sizeof(float);
+
+      case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
+        return sizeof(double);
+
+      case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
+        return sizeof(SIMCONNECT_DATA_LATLONALT);
+
+      case SIMCONNECT_VARIABLE_TYPE_XYZ:
+        return sizeof(SIMCONNECT_DATA_XYZ);
+
+      // strings are stored inline with fixed capacity including the terminating zero
+      case SIMCONNECT_VARIABLE_TYPE_STRING8:
+        return 8;
+
+      case SIMCONNECT_VARIABLE_TYPE_STRING32:
+        return 32;
+
+      case SIMCONNECT_VARIABLE_TYPE_STRING64:
+        return 64;
+
+      case SIMCONNECT_VARIABLE_TYPE_STRING256:
+        return 256;
+
+      default:
+        return 0;
+    }
+  }
+
   static SIMCONNECT_DATATYPE convert(
       SIMCONNECT_VARIABLE_TYPE type
   ) {
@@ -68,6 +130,18 @@ class SimConnectVariableType {
       case SIMCONNECT_VARIABLE_TYPE_XYZ:
         return SIMCONNECT_DATATYPE_XYZ;
 
+      case SIMCONNECT_VARIABLE_TYPE_STRING8:
+        return SIMCONNECT_DATATYPE_STRING8;
+
+      case SIMCONNECT_VARIABLE_TYPE_STRING32:
+        return SIMCONNECT_DATATYPE_STRING32;
+
+      case SIMCONNECT_VARIABLE_TYPE_STRING64:
+        return SIMCONNECT_DATATYPE_STRING64;
+
+      case SIMCONNECT_VARIABLE_TYPE_STRING256:
+        return SIMCONNECT_DATATYPE_STRING256;
+
       default:
         return SIMCONNECT_DATATYPE_INVALID;
     }
@@ -92,10 +166,53 @@ class SimConnectVariableType {
       case SIMCONNECT_DATATYPE_XYZ:
         return SIMCONNECT_VARIABLE_TYPE_XYZ;
 
+      case SIMCONNECT_DATATYPE_STRING8:
+        return SIMCONNECT_VARIABLE_TYPE_STRING8;
+
+      case SIMCONNECT_DATATYPE_STRING32:
+        return SIMCONNECT_VARIABLE_TYPE_STRING32;
+
+      case SIMCONNECT_DATATYPE_STRING64:
+        return SIMCONNECT_VARIABLE_TYPE_STRING64;
+
+      // variable length strings are stored in the largest fixed slot
+      case SIMCONNECT_DATATYPE_STRING256:
+      case SIMCONNECT_DATATYPE_STRINGV:
+        return SIMCONNECT_VARIABLE_TYPE_STRING256;
+
       default:
         return SIMCONNECT_VARIABLE_TYPE_INVALID;
     }
   }
+
+  static SIMCONNECT_VARIABLE_TYPE fromName(
+      std::string_view name
+  ) {
+    // names as used in the variable syntax and the variable registry
+    if (name == "BOOL") {
+      return SIMCONNECT_VARIABLE_TYPE_BOOL;
+    } else if (name == "INT32") {
+      return SIMCONNECT_VARIABLE_TYPE_INT32;
+    } else if (name == "FLOAT32") {
+      return SIMCONNECT_VARIABLE_TYPE_FLOAT32;
+    } else if (name == "FLOAT64") {
+      return SIMCONNECT_VARIABLE_TYPE_FLOAT64;
+    } else if (name == "LATLONALT") {
+      return SIMCONNECT_VARIABLE_TYPE_LATLONALT;
+    } else if (name == "XYZ") {
+      return SIMCONNECT_VARIABLE_TYPE_XYZ;
+    } else if (name == "STRING8") {
+      return SIMCONNECT_VARIABLE_TYPE_STRING8;
+    } else if (name == "STRING32") {
+      return SIMCONNECT_VARIABLE_TYPE_STRING32;
+    } else if (name == "STRING64") {
+      return SIMCONNECT_VARIABLE_TYPE_STRING64;
+    } else if (name == "STRING256" || name == "STRINGV") {
+      // variable length strings are stored in the largest fixed slot
+      return SIMCONNECT_VARIABLE_TYPE_STRING256;
+    }
+    return SIMCONNECT_VARIABLE_TYPE_INVALID;
+  }
 };
 
 }
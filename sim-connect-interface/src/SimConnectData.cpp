@@ -14,82 +14,149 @@
  *     limitations under the License.
  */
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 #include "SimConnectData.h"
+#include "SimConnectDataHash.h"
 
 using namespace simconnect::toolbox::connection;
 
 SimConnectData::SimConnectData(
-    const SimConnectDataDefinition &dataDefinition
-) : dataDefinition(dataDefinition), indexMapping() {
+    const SimConnectDataDefinition &dataDefinition,
+    const std::shared_ptr<SimConnectDataArena> &arena,
+    const SimConnectDataLayout &layout,
+    std::pmr::memory_resource *resource
+) : dataDefinition(dataDefinition), dataLayout(layout), memoryResource(resource), dataArena(arena), stringHashes(resource) {
+  // check layout
+  if (!dataLayout.isValid()) {
+    throw std::invalid_argument("Data layout is not valid!");
+  }
+
   // get counts
   memberCount = getMemberCountFromDataDefinition(dataDefinition);
 
-  // get total size
-  totalSize = getTotalSize(memberCount);
+  // get offsets of the groups and the total size
+  totalSize = getMemberOffsets(memberCount, dataLayout, memberOffset);
 
-  // allocate buffer and set it to zero
-  buffer = new char[totalSize];
+  // allocate buffer from the arena if it provides the alignment and set it to zero
+  if (dataArena && dataLayout.groupAlignment <= SimConnectDataArena::CACHE_LINE_SIZE) {
+    buffer = dataArena->allocate(totalSize);
+  } else {
+    allocationAlignment = std::max<size_t>(dataLayout.groupAlignment, alignof(std::max_align_t));
+    allocation = static_cast<char *>(memoryResource->allocate(std::max<size_t>(totalSize, 1), allocationAlignment));
+    buffer = allocation;
+  }
   std::fill(buffer, buffer + totalSize, 0);
 
   // setup memory accessors
   setupMemoryAccessors();
+
+  // every string slot keeps the hash of its content for change detection
+  stringHashes.resize(
+      memberCount.countString8 + memberCount.countString32 + memberCount.countString64 + memberCount.countString256
+  );
+  updateStringHashes();
+
+  // content hash of the empty buffer, so that an empty first frame is detected as unchanged
+  contentHash = SimConnectDataHash::hash(buffer, totalSize);
 }
 
 SimConnectData::~SimConnectData() {
-  delete[] buffer;
+  // buffers of an arena are given back to it, so a later data object of the connection can reuse the slot
+  if (allocation) {
+    memoryResource->deallocate(allocation, std::max<size_t>(totalSize, 1), allocationAlignment);
+  } else if (dataArena && buffer) {
+    dataArena->deallocate(buffer, totalSize);
+  }
+  allocation = nullptr;
   buffer = nullptr;
 }
 
+const SimConnectDataLayout &SimConnectData::getLayout() const {
+  return dataLayout;
+}
+
 SimConnectData::MemberCount SimConnectData::getMemberCountFromDataDefinition(
-    SimConnectDataDefinition _dataDefinition
+    const SimConnectDataDefinition &_dataDefinition
 ) {
   MemberCount count = {};
-  for (int index = 0; index < _dataDefinition.size(); ++index) {
-    switch (_dataDefinition.getType(index)) {
+  count.countBoolean = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_BOOL);
+  count.countInt32 = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_INT32);
+  count.countFloat32 = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_FLOAT32);
+  count.countFloat64 = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_FLOAT64);
+  count.countLatLonAlt = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_LATLONALT);
+  count.countXYZ = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_XYZ);
+  count.countString8 = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_STRING8);
+  count.countString32 = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_STRING32);
+  count.countString64 = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_STRING64);
+  count.countString256 = _dataDefinition.getTypeCount(SIMCONNECT_VARIABLE_TYPE_STRING256);
+  return count;
+}
+
+size_t SimConnectData::getMemberOffsets(
+    const MemberCount &counts,
+    const SimConnectDataLayout &layout,
+    MemberOffset &offsets
+) {
+  // groups are placed in the order of the layout, strings behind all numeric groups
+  size_t offset = 0;
+  auto place = [&](SIMCONNECT_VARIABLE_TYPE type) {
+    switch (type) {
       case SIMCONNECT_VARIABLE_TYPE_BOOL:
-        indexMapping.push_back(count.countBoolean);
-        count.countBoolean++;
+        offsets.offsetBoolean = offset;
+        offset += layout.getGroupSize(type, counts.countBoolean);
         break;
       case SIMCONNECT_VARIABLE_TYPE_INT32:
-        indexMapping.push_back(count.countInt32);
-        count.countInt32++;
+        offsets.offsetInt32 = offset;
+        offset += layout.getGroupSize(type, counts.countInt32);
         break;
       case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
-        indexMapping.push_back(count.countFloat32);
-        count.countFloat32++;
+        offsets.offsetFloat32 = offset;
+        offset += layout.getGroupSize(type, counts.countFloat32);
         break;
       case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
-        indexMapping.push_back(count.countFloat64);
-        count.countFloat64++;
+        offsets.offsetFloat64 = offset;
+        offset += layout.getGroupSize(type, counts.countFloat64);
         break;
       case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
-        indexMapping.push_back(count.countLatLonAlt);
-        count.countLatLonAlt++;
+        offsets.offsetLatLonAlt = offset;
+        offset += layout.getGroupSize(type, counts.countLatLonAlt);
         break;
       case SIMCONNECT_VARIABLE_TYPE_XYZ:
-        indexMapping.push_back(count.countXYZ);
-        count.countXYZ++;
+        offsets.offsetXYZ = offset;
+        offset += layout.getGroupSize(type, counts.countXYZ);
+        break;
+      case SIMCONNECT_VARIABLE_TYPE_STRING8:
+        offsets.offsetString8 = offset;
+        offset += layout.getGroupSize(type, counts.countString8);
+        break;
+      case SIMCONNECT_VARIABLE_TYPE_STRING32:
+        offsets.offsetString32 = offset;
+        offset += layout.getGroupSize(type, counts.countString32);
+        break;
+      case SIMCONNECT_VARIABLE_TYPE_STRING64:
+        offsets.offsetString64 = offset;
+        offset += layout.getGroupSize(type, counts.countString64);
+        break;
+      case SIMCONNECT_VARIABLE_TYPE_STRING256:
+        offsets.offsetString256 = offset;
+        offset += layout.getGroupSize(type, counts.countString256);
         break;
-
       default:
         break;
     }
+  };
+  for (auto type : layout.groupOrder) {
+    place(type);
   }
-  return count;
-}
-
-size_t SimConnectData::getTotalSize(
-    MemberCount counts
-) {
-  size_t size = 0;
-  size += MemoryAccessor<int>::getSizeWithPadding(counts.countBoolean, 4);
-  size += MemoryAccessor<long>::getSizeWithPadding(counts.countInt32, 8);
-  size += MemoryAccessor<float>::getSizeWithPadding(counts.countFloat32, 8);
-  size += MemoryAccessor<double>::getSizeWithPadding(counts.countFloat64, 8);
-  size += MemoryAccessor<SIMCONNECT_DATA_LATLONALT>::getSizeWithPadding(counts.countLatLonAlt, 8);
-  size += MemoryAccessor<SIMCONNECT_DATA_XYZ>::getSizeWithPadding(counts.countXYZ, 8);
-  return size;
+  for (auto type : SimConnectDataLayout::STRING_GROUP_ORDER) {
+    place(type);
+  }
+  return offset;
 }
 
 char *SimConnectData::getBuffer() {
@@ -97,57 +164,86 @@ char *SimConnectData::getBuffer() {
 }
 
 void SimConnectData::setupMemoryAccessors() {
-  // variable for offset
-  size_t offset = 0;
   if (memberCount.countBoolean > 0) {
-    memoryAccessorBoolean = std::make_shared<MemoryAccessor<int>>(
-        buffer + offset,
+    memoryAccessorBoolean = MemoryAccessor<int>(
+        buffer + memberOffset.offsetBoolean,
         memberCount.countBoolean
     );
-    offset += MemoryAccessor<int>::getSizeWithPadding(memberCount.countBoolean, 4);
   }
   if (memberCount.countInt32 > 0) {
-    memoryAccessorInt32 = std::make_shared<MemoryAccessor<long>>(
-        buffer + offset,
+    memoryAccessorInt32 = MemoryAccessor<long>(
+        buffer + memberOffset.offsetInt32,
         memberCount.countInt32
     );
-    offset += MemoryAccessor<long>::getSizeWithPadding(memberCount.countInt32, 8);
   }
   if (memberCount.countFloat32 > 0) {
-    memoryAccessorFloat32 = std::make_shared<MemoryAccessor<float>>(
-        buffer + offset,
+    memoryAccessorFloat32 = MemoryAccessor<float>(
+        buffer + memberOffset.offsetFloat32,
         memberCount.countFloat32
     );
-    offset += MemoryAccessor<float>::getSizeWithPadding(memberCount.countFloat32, 8);
   }
   if (memberCount.countFloat64 > 0) {
-    memoryAccessorFloat64 = std::make_shared<MemoryAccessor<double>>(
-        buffer + offset,
+    memoryAccessorFloat64 = MemoryAccessor<double>(
+        buffer + memberOffset.offsetFloat64,
         memberCount.countFloat64
     );
-    offset += MemoryAccessor<double>::getSizeWithPadding(memberCount.countFloat64, 8);
   }
   if (memberCount.countLatLonAlt > 0) {
-    memoryAccessorLatLonAlt = std::make_shared<MemoryAccessor<SIMCONNECT_DATA_LATLONALT>>(
-        buffer + offset,
+    memoryAccessorLatLonAlt = MemoryAccessor<SIMCONNECT_DATA_LATLONALT>(
+        buffer + memberOffset.offsetLatLonAlt,
         memberCount.countLatLonAlt
     );
-    offset += MemoryAccessor<SIMCONNECT_DATA_LATLONALT>::getSizeWithPadding(memberCount.countLatLonAlt, 8);
   }
   if (memberCount.countXYZ > 0) {
-    memoryAccessorXYZ = std::make_shared<MemoryAccessor<SIMCONNECT_DATA_XYZ>>(
-        buffer + offset,
+    memoryAccessorXYZ = MemoryAccessor<SIMCONNECT_DATA_XYZ>(
+        buffer + memberOffset.offsetXYZ,
         memberCount.countXYZ
     );
-    offset += MemoryAccessor<SIMCONNECT_DATA_XYZ>::getSizeWithPadding(memberCount.countXYZ, 8);
   }
+}
 
-  // ensure total size and offset is matching
-  if (offset != totalSize) {
-    throw std::exception("Offset and total size are different!");
+size_t SimConnectData::getOffset(
+    SIMCONNECT_VARIABLE_TYPE type
+) const {
+  switch (type) {
+    case SIMCONNECT_VARIABLE_TYPE_BOOL:
+      return memberOffset.offsetBoolean;
+    case SIMCONNECT_VARIABLE_TYPE_INT32:
+      return memberOffset.offsetInt32;
+    case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
+      return memberOffset.offsetFloat32;
+    case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
+      return memberOffset.offsetFloat64;
+    case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
+      return memberOffset.offsetLatLonAlt;
+    case SIMCONNECT_VARIABLE_TYPE_XYZ:
+      return memberOffset.offsetXYZ;
+    case SIMCONNECT_VARIABLE_TYPE_STRING8:
+      return memberOffset.offsetString8;
+    case SIMCONNECT_VARIABLE_TYPE_STRING32:
+      return memberOffset.offsetString32;
+    case SIMCONNECT_VARIABLE_TYPE_STRING64:
+      return memberOffset.offsetString64;
+    case SIMCONNECT_VARIABLE_TYPE_STRING256:
+      return memberOffset.offsetString256;
+    default:
+      throw std::exception("Type not known!");
   }
 }
 
+size_t SimConnectData::getVariableOffset(
+    size_t index
+) {
+  auto type = dataDefinition.getType(index);
+  return getOffset(type) + dataDefinition.getTypeIndex(index) * SimConnectVariableType::getSize(type);
+}
+
+size_t SimConnectData::getGroupIndex(
+    size_t index
+) const {
+  return dataDefinition.getTypeIndex(index);
+}
+
 size_t SimConnectData::size() const {
   return totalSize;
 }
@@ -157,17 +253,22 @@ std::any SimConnectData::get(
 ) {
   switch (dataDefinition.getType(index)) {
     case SIMCONNECT_VARIABLE_TYPE_BOOL:
-      return static_cast<bool>(memoryAccessorBoolean->get(indexMapping[index]));
+      return static_cast<bool>(memoryAccessorBoolean.get(dataDefinition.getTypeIndex(index)));
     case SIMCONNECT_VARIABLE_TYPE_INT32:
-      return memoryAccessorInt32->get(indexMapping[index]);
+      return memoryAccessorInt32.get(dataDefinition.getTypeIndex(index));
     case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
-      return memoryAccessorFloat32->get(indexMapping[index]);
+      return memoryAccessorFloat32.get(dataDefinition.getTypeIndex(index));
     case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
-      return memoryAccessorFloat64->get(indexMapping[index]);
+      return memoryAccessorFloat64.get(dataDefinition.getTypeIndex(index));
     case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
-      return memoryAccessorLatLonAlt->get(indexMapping[index]);
+      return memoryAccessorLatLonAlt.get(dataDefinition.getTypeIndex(index));
     case SIMCONNECT_VARIABLE_TYPE_XYZ:
-      return memoryAccessorXYZ->get(indexMapping[index]);
+      return memoryAccessorXYZ.get(dataDefinition.getTypeIndex(index));
+    case SIMCONNECT_VARIABLE_TYPE_STRING8:
+    case SIMCONNECT_VARIABLE_TYPE_STRING32:
+    case SIMCONNECT_VARIABLE_TYPE_STRING64:
+    case SIMCONNECT_VARIABLE_TYPE_STRING256:
+      return getString(index);
     default:
       throw std::exception("No item found!");
   }
@@ -179,30 +280,164 @@ void SimConnectData::set(
 ) {
   switch (dataDefinition.getType(index)) {
     case SIMCONNECT_VARIABLE_TYPE_BOOL:
-      memoryAccessorBoolean->set(indexMapping[index], std::any_cast<bool>(value));
+      memoryAccessorBoolean.set(dataDefinition.getTypeIndex(index), std::any_cast<bool>(value));
       break;
     case SIMCONNECT_VARIABLE_TYPE_INT32:
-      memoryAccessorInt32->set(indexMapping[index], std::any_cast<long>(value));
+      memoryAccessorInt32.set(dataDefinition.getTypeIndex(index), std::any_cast<long>(value));
       break;
     case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
-      memoryAccessorFloat32->set(indexMapping[index], std::any_cast<float>(value));
+      memoryAccessorFloat32.set(dataDefinition.getTypeIndex(index), std::any_cast<float>(value));
       break;
     case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
-      memoryAccessorFloat64->set(indexMapping[index], std::any_cast<double>(value));
+      memoryAccessorFloat64.set(dataDefinition.getTypeIndex(index), std::any_cast<double>(value));
       break;
     case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
-      memoryAccessorLatLonAlt->set(indexMapping[index], std::any_cast<SIMCONNECT_DATA_LATLONALT>(value));
+      memoryAccessorLatLonAlt.set(dataDefinition.getTypeIndex(index), std::any_cast<SIMCONNECT_DATA_LATLONALT>(value));
       break;
     case SIMCONNECT_VARIABLE_TYPE_XYZ:
-      memoryAccessorXYZ->set(indexMapping[index], std::any_cast<SIMCONNECT_DATA_XYZ>(value));
+      memoryAccessorXYZ.set(dataDefinition.getTypeIndex(index), std::any_cast<SIMCONNECT_DATA_XYZ>(value));
+      break;
+    case SIMCONNECT_VARIABLE_TYPE_STRING8:
+    case SIMCONNECT_VARIABLE_TYPE_STRING32:
+    case SIMCONNECT_VARIABLE_TYPE_STRING64:
+    case SIMCONNECT_VARIABLE_TYPE_STRING256:
+      if (value.type() == typeid(std::string)) {
+        setString(index, std::any_cast<const std::string &>(value));
+      } else {
+        setString(index, std::any_cast<std::string_view>(value));
+      }
       break;
     default:
       throw std::exception("Parameter not known!");
   }
 }
 
+std::string_view SimConnectData::getString(
+    size_t index
+) const {
+  // the content ends at the first zero or at the capacity of the slot
+  auto type = dataDefinition.getType(index);
+  if (!SimConnectVariableType::isString(type)) {
+    throw std::invalid_argument("Variable is not a string!");
+  }
+  size_t capacity = SimConnectVariableType::getSize(type);
+  const char *slot = buffer + getOffset(type) + dataDefinition.getTypeIndex(index) * capacity;
+  return {slot, static_cast<size_t>(std::find(slot, slot + capacity, '\0') - slot)};
+}
+
+void SimConnectData::setString(
+    size_t index,
+    std::string_view value
+) {
+  // values are truncated to the capacity, the rest of the slot is cleared
+  auto type = dataDefinition.getType(index);
+  if (!SimConnectVariableType::isString(type)) {
+    throw std::invalid_argument("Variable is not a string!");
+  }
+  size_t capacity = SimConnectVariableType::getSize(type);
+  char *slot = buffer + getOffset(type) + dataDefinition.getTypeIndex(index) * capacity;
+  size_t length = std::min(value.size(), capacity - 1);
+  std::copy(value.begin(), value.begin() + length, slot);
+  std::fill(slot + length, slot + capacity, 0);
+  stringHashes[getStringSlot(index)] = hashString({slot, length});
+}
+
+uint64_t SimConnectData::getStringHash(
+    size_t index
+) const {
+  return stringHashes[getStringSlot(index)];
+}
+
+bool SimConnectData::hasStringChanged(
+    size_t index,
+    uint64_t &hash
+) const {
+  // the caller keeps the hash it has seen last, only the hashes are compared
+  uint64_t current = getStringHash(index);
+  if (current == hash) {
+    return false;
+  }
+  hash = current;
+  return true;
+}
+
+size_t SimConnectData::getStringSlot(
+    size_t index
+) const {
+  // hashes are stored in the order of the string groups
+  size_t typeIndex = dataDefinition.getTypeIndex(index);
+  switch (dataDefinition.getType(index)) {
+    case SIMCONNECT_VARIABLE_TYPE_STRING8:
+      return typeIndex;
+    case SIMCONNECT_VARIABLE_TYPE_STRING32:
+      return memberCount.countString8 + typeIndex;
+    case SIMCONNECT_VARIABLE_TYPE_STRING64:
+      return memberCount.countString8 + memberCount.countString32 + typeIndex;
+    case SIMCONNECT_VARIABLE_TYPE_STRING256:
+      return memberCount.countString8 + memberCount.countString32 + memberCount.countString64 + typeIndex;
+    default:
+      throw std::invalid_argument("Variable is not a string!");
+  }
+}
+
+void SimConnectData::updateStringHashes() {
+  // data without strings does not pay for change detection
+  if (stringHashes.empty()) {
+    return;
+  }
+  size_t slotIndex = 0;
+  for (auto type : SimConnectDataLayout::STRING_GROUP_ORDER) {
+    size_t capacity = SimConnectVariableType::getSize(type);
+    const char *slot = buffer + getOffset(type);
+    for (size_t kI = 0; kI < dataDefinition.getTypeCount(type); ++kI, slot += capacity) {
+      auto length = static_cast<size_t>(std::find(slot, slot + capacity, '\0') - slot);
+      stringHashes[slotIndex++] = hashString({slot, length});
+    }
+  }
+}
+
+uint64_t SimConnectData::hashString(
+    std::string_view value
+) {
+  // 64-bit FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  for (auto character : value) {
+    hash ^= static_cast<unsigned char>(character);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
 void SimConnectData::copy(
     char *pBuffer
 ) {
+  // frames with identical content are detected by their hash, strings did not change in that case
+  auto hash = SimConnectDataHash::hash(pBuffer, totalSize);
+  isContentUnchanged = hash == contentHash;
+  contentHash = hash;
+
   memcpy_s(this->buffer, totalSize, pBuffer, totalSize);
+  if (!isContentUnchanged) {
+    updateStringHashes();
+  }
+}
+
+uint64_t SimConnectData::getContentHash() const {
+  return contentHash;
+}
+
+bool SimConnectData::isUnchanged() const {
+  return isContentUnchanged;
+}
+
+void SimConnectData::carryOver(
+    SimConnectData &previous
+) {
+  // take over values of variables that are part of both definitions
+  for (size_t index = 0; index < dataDefinition.size(); ++index) {
+    size_t previousIndex = 0;
+    if (previous.dataDefinition.find(dataDefinition.get(index), previousIndex)) {
+      set(index, previous.get(previousIndex));
+    }
+  }
 }
@@ -0,0 +1,219 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include "SimConnectDataArena.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+SimConnectDataArena::SimConnectDataArena(
+    size_t blockSize,
+    pmr::memory_resource *resource
+) : blockSize(align(max(blockSize, CACHE_LINE_SIZE))), memoryResource(resource), blocks(resource), freeSlots(resource) {
+}
+
+SimConnectDataArena::~SimConnectDataArena() {
+  for (auto &block : blocks) {
+    memoryResource->deallocate(block.data, block.capacity, CACHE_LINE_SIZE);
+  }
+}
+
+shared_ptr<SimConnectDataArena> SimConnectDataArena::get(
+    const string &name
+) {
+  lock_guard<std::mutex> lock(registryMutex);
+
+  // data of the same connection shares one arena
+  auto arena = registry[name].lock();
+  if (!arena) {
+    arena = make_shared<SimConnectDataArena>();
+    registry[name] = arena;
+  }
+
+  // return result
+  return arena;
+}
+
+char *SimConnectDataArena::allocate(
+    size_t size
+) {
+  lock_guard<std::mutex> lock(mutex);
+
+  // every buffer starts on a cache line
+  size = align(max(size, static_cast<size_t>(1)));
+
+  // a released slot is reused when the buffer fits into it, the rest of the slot stays free
+  for (auto slot = freeSlots.begin(); slot != freeSlots.end(); ++slot) {
+    if (slot->second < size) {
+      continue;
+    }
+    char *buffer = slot->first;
+    size_t remaining = slot->second - size;
+    freeSlots.erase(slot);
+    if (remaining > 0) {
+      freeSlots.emplace(buffer + size, remaining);
+    }
+    fill(buffer, buffer + size, 0);
+    bufferCount++;
+    return buffer;
+  }
+
+  // buffers are placed behind each other, a new block is only needed when no block has room left at its end
+  auto block = find_if(blocks.begin(), blocks.end(), [size](const Block &entry) {
+    return entry.capacity - entry.used >= size;
+  });
+  if (block == blocks.end()) {
+    Block newBlock;
+    newBlock.capacity = max(blockSize, size);
+    newBlock.data = static_cast<char *>(memoryResource->allocate(newBlock.capacity, CACHE_LINE_SIZE));
+    blocks.push_back(newBlock);
+    block = std::prev(blocks.end());
+  }
+
+  // hand out buffer, it is set to zero also when a released buffer was there before
+  char *buffer = block->data + block->used;
+  fill(buffer, buffer + size, 0);
+  block->used += size;
+  bufferCount++;
+
+  // return result
+  return buffer;
+}
+
+void SimConnectDataArena::deallocate(
+    char *buffer,
+    size_t size
+) {
+  lock_guard<std::mutex> lock(mutex);
+
+  // find block of the buffer
+  size = align(max(size, static_cast<size_t>(1)));
+  auto block = find_if(blocks.begin(), blocks.end(), [buffer](const Block &entry) {
+    return buffer >= entry.data && buffer < entry.data + entry.used;
+  });
+  if (block == blocks.end()) {
+    return;
+  }
+  bufferCount--;
+
+  // merge with free neighbours in the same block
+  auto next = freeSlots.lower_bound(buffer);
+  if (next != freeSlots.end() && next->first == buffer + size && next->first < block->data + block->used) {
+    size += next->second;
+    next = freeSlots.erase(next);
+  }
+  if (next != freeSlots.begin()) {
+    auto previous = std::prev(next);
+    if (previous->first >= block->data && previous->first + previous->second == buffer) {
+      buffer = previous->first;
+      size += previous->second;
+      freeSlots.erase(previous);
+    }
+  }
+
+  // a slot at the end of the block is given back to it, so snapshots do not grow with released buffers
+  if (buffer + size == block->data + block->used) {
+    block->used -= size;
+    return;
+  }
+  freeSlots.emplace(buffer, size);
+}
+
+size_t SimConnectDataArena::size() const {
+  lock_guard<std::mutex> lock(mutex);
+  size_t result = 0;
+  forEachBuffer([&result](char *, size_t size) {
+    result += size;
+  });
+  return result;
+}
+
+size_t SimConnectDataArena::getAllocationCount() const {
+  lock_guard<std::mutex> lock(mutex);
+  return blocks.size();
+}
+
+size_t SimConnectDataArena::getBufferCount() const {
+  lock_guard<std::mutex> lock(mutex);
+  return bufferCount;
+}
+
+void SimConnectDataArena::snapshot(
+    vector<char> &target
+) const {
+  lock_guard<std::mutex> lock(mutex);
+
+  // only buffers in use are copied, a compact arena is copied with a single memcpy per block
+  size_t offset = 0;
+  forEachBuffer([&](char *data, size_t size) {
+    target.resize(offset + size);
+    copy_n(data, size, target.data() + offset);
+    offset += size;
+  });
+  target.resize(offset);
+}
+
+bool SimConnectDataArena::restore(
+    const vector<char> &source
+) {
+  lock_guard<std::mutex> lock(mutex);
+
+  // check if snapshot matches layout
+  size_t total = 0;
+  forEachBuffer([&total](char *, size_t size) {
+    total += size;
+  });
+  if (source.size() != total) {
+    return false;
+  }
+
+  // copy data back
+  size_t offset = 0;
+  forEachBuffer([&](char *data, size_t size) {
+    copy_n(source.data() + offset, size, data);
+    offset += size;
+  });
+
+  // success
+  return true;
+}
+
+void SimConnectDataArena::forEachBuffer(
+    const function<void(char *, size_t)> &function
+) const {
+  // contiguous ranges in use of every block, released slots in between are skipped
+  for (const auto &block : blocks) {
+    char *begin = block.data;
+    char *end = block.data + block.used;
+    for (auto slot = freeSlots.lower_bound(begin); slot != freeSlots.end() && slot->first < end; ++slot) {
+      if (slot->first > begin) {
+        function(begin, static_cast<size_t>(slot->first - begin));
+      }
+      begin = slot->first + slot->second;
+    }
+    if (end > begin) {
+      function(begin, static_cast<size_t>(end - begin));
+    }
+  }
+}
+
+size_t SimConnectDataArena::align(
+    size_t size
+) {
+  return (size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+}
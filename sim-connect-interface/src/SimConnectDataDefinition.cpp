@@ -14,60 +14,114 @@
  *     limitations under the License.
  */
 
+#include <algorithm>
+#include <cctype>
 #include <iostream>
+#include <string>
 #include <utility>
 #include "SimConnectDataDefinition.h"
 
 using namespace std;
 using namespace simconnect::toolbox::connection;
 
-SimConnectDataDefinition::SimConnectDataDefinition() : variables() {
+SimConnectDataDefinition::Builder::Builder(
+    pmr::memory_resource *resource
+) : storage(createStorage(resource)) {
 }
 
-SimConnectDataDefinition::SimConnectDataDefinition(
-    const SimConnectDataDefinition &other
+SimConnectDataDefinition::Builder &SimConnectDataDefinition::Builder::reserve(
+    size_t count
 ) {
-  variables.clear();
-  for (const auto &variable : other.variables) {
-    variables.push_back(variable);
-  }
+  storage->variables.reserve(count);
+  storage->types.reserve(count);
+  storage->typeIndices.reserve(count);
+  storage->logicalVariables.reserve(count);
+  storage->physicalIndices.reserve(count);
+  storage->conversions.reserve(count);
+  storage->physicalIndexByName.reserve(count);
+  return *this;
 }
 
-SimConnectDataDefinition &SimConnectDataDefinition::operator=(
-    const SimConnectDataDefinition &other
+SimConnectDataDefinition::Builder &SimConnectDataDefinition::Builder::add(
+    const SimConnectVariable &item
 ) {
-  variables.clear();
-  for (const auto &variable : other.variables) {
-    variables.push_back(variable);
-  }
+  append(*storage, item);
   return *this;
 }
 
+size_t SimConnectDataDefinition::Builder::getLogicalSize() const {
+  return storage->logicalVariables.size();
+}
+
+SimConnectDataDefinition SimConnectDataDefinition::Builder::build() {
+  // the storage is handed over and never changed again
+  auto resource = storage->variables.get_allocator().resource();
+  auto result = SimConnectDataDefinition(std::move(storage));
+  storage = createStorage(resource);
+  return result;
+}
+
+SimConnectDataDefinition::SimConnectDataDefinition(
+    pmr::memory_resource *resource
+) : storage(createStorage(resource)) {
+}
+
+SimConnectDataDefinition::SimConnectDataDefinition(
+    shared_ptr<const Storage> storage
+) : storage(std::move(storage)) {
+}
+
 SimConnectDataDefinition::~SimConnectDataDefinition() = default;
 
+bool SimConnectDataDefinition::operator==(
+    const SimConnectDataDefinition &other
+) const {
+  return storage == other.storage || storage->logicalVariables == other.storage->logicalVariables;
+}
+
+bool SimConnectDataDefinition::operator!=(
+    const SimConnectDataDefinition &other
+) const {
+  return !(*this == other);
+}
+
 void SimConnectDataDefinition::add(
     const SimConnectVariable &item
 ) {
-  if (!SimConnectVariableLookupTable::isKnown(item)) {
-    throw std::invalid_argument("Variable is not known!");
-  }
-  variables.push_back(item);
+  // storage is never changed once created -> copy, many variables are added with the builder
+  auto resource = storage->variables.get_allocator().resource();
+  auto next = allocate_shared<Storage>(pmr::polymorphic_allocator<Storage>(resource), *storage);
+  append(*next, item);
+  storage = std::move(next);
 }
 
-SimConnectVariable SimConnectDataDefinition::get(
+const SimConnectVariable &SimConnectDataDefinition::get(
     size_t index
-) {
-  return variables[index];
+) const {
+  return storage->variables[index];
 }
 
-size_t SimConnectDataDefinition::size() {
-  return variables.size();
+size_t SimConnectDataDefinition::size() const {
+  return storage->variables.size();
+}
+
+bool SimConnectDataDefinition::find(
+    const SimConnectVariable &item,
+    size_t &index
+) const {
+  const auto &variables = storage->variables;
+  auto it = std::find(variables.begin(), variables.end(), item);
+  if (it == variables.end()) {
+    return false;
+  }
+  index = static_cast<size_t>(std::distance(variables.begin(), it));
+  return true;
 }
 
 SIMCONNECT_VARIABLE_TYPE SimConnectDataDefinition::getType(
     size_t index
-) {
-  return getType(get(index));
+) const {
+  return storage->types[index];
 }
 
 SIMCONNECT_VARIABLE_TYPE SimConnectDataDefinition::getType(
@@ -75,3 +129,190 @@ SIMCONNECT_VARIABLE_TYPE SimConnectDataDefinition::getType(
 ) {
   return SimConnectVariableLookupTable::getDataType(item);
 }
+
+size_t SimConnectDataDefinition::getTypeIndex(
+    size_t index
+) const {
+  return storage->typeIndices[index];
+}
+
+size_t SimConnectDataDefinition::getTypeCount(
+    SIMCONNECT_VARIABLE_TYPE type
+) const {
+  return storage->typeCounts[type];
+}
+
+bool SimConnectDataDefinition::isSharedWith(
+    const SimConnectDataDefinition &other
+) const {
+  return storage == other.storage;
+}
+
+size_t SimConnectDataDefinition::getLogicalSize() const {
+  return storage->logicalVariables.size();
+}
+
+const SimConnectVariable &SimConnectDataDefinition::getLogical(
+    size_t logicalIndex
+) const {
+  return storage->logicalVariables[logicalIndex];
+}
+
+size_t SimConnectDataDefinition::getPhysicalIndex(
+    size_t logicalIndex
+) const {
+  return storage->physicalIndices[logicalIndex];
+}
+
+const SimConnectUnitConversion &SimConnectDataDefinition::getConversion(
+    size_t logicalIndex
+) const {
+  return storage->conversions[logicalIndex];
+}
+
+bool SimConnectDataDefinition::isConverted(
+    size_t logicalIndex
+) const {
+  const auto &conversion = storage->conversions[logicalIndex];
+  return conversion.scale != 1.0 || conversion.offset != 0.0;
+}
+
+SimConnectVariable SimConnectDataDefinition::canonicalize(
+    const SimConnectVariable &item
+) {
+  // removes leading, trailing and repeated whitespace
+  auto normalizeWhitespace = [](const string &value) {
+    string result;
+    for (auto character : value) {
+      if (isspace(static_cast<unsigned char>(character))) {
+        if (!result.empty() && result.back() != ' ') {
+          result.push_back(' ');
+        }
+      } else {
+        result.push_back(character);
+      }
+    }
+    if (!result.empty() && result.back() == ' ') {
+      result.pop_back();
+    }
+    return result;
+  };
+
+  // indices are written without whitespace and leading zeros
+  string name = normalizeWhitespace(item.name);
+  size_t kIndex = name.rfind(':');
+  if (kIndex != string::npos) {
+    string prefix = normalizeWhitespace(name.substr(0, kIndex));
+    string index = normalizeWhitespace(name.substr(kIndex + 1));
+    if (!index.empty() && all_of(index.begin(), index.end(), [](unsigned char ch) { return isdigit(ch); })) {
+      index.erase(0, min(index.find_first_not_of('0'), index.size() - 1));
+      name = prefix + ":" + index;
+    }
+  }
+
+  // aliases of a unit are replaced by its canonical name
+  string unit = normalizeWhitespace(item.unit);
+  unit = string(SimConnectUnit::getCanonicalName(unit));
+
+  // keep options
+  SimConnectVariable result(name, unit);
+  result.isStatic = item.isStatic;
+  result.priority = item.priority;
+  result.type = item.type;
+  result.isAdaptive = item.isAdaptive;
+  result.adaptiveErrorBound = item.adaptiveErrorBound;
+  return result;
+}
+
+shared_ptr<SimConnectDataDefinition::Storage> SimConnectDataDefinition::createStorage(
+    pmr::memory_resource *resource
+) {
+  // the control block and the arrays are taken from the same resource
+  return allocate_shared<Storage>(pmr::polymorphic_allocator<Storage>(resource), resource);
+}
+
+void SimConnectDataDefinition::append(
+    Storage &storage,
+    const SimConnectVariable &item
+) {
+  auto variable = canonicalize(item);
+  if (!SimConnectVariableLookupTable::isKnown(variable)) {
+    throw std::invalid_argument("Variable is not known!");
+  }
+  auto type = getType(variable);
+
+  // duplicates and the same variable in another unit are mapped to the first matching physical variable, the
+  // order of equal names in the multimap is not defined
+  size_t sameIndex = storage.variables.size();
+  auto [first, last] = storage.physicalIndexByName.equal_range(variable.name.getId());
+  for (auto it = first; it != last; ++it) {
+    if (it->second < sameIndex && isSameVariable(storage, it->second, variable, type)) {
+      sameIndex = it->second;
+    }
+  }
+  if (sameIndex < storage.variables.size()) {
+    storage.logicalVariables.push_back(item);
+    storage.physicalIndices.push_back(sameIndex);
+    storage.conversions.push_back(
+        type == SIMCONNECT_VARIABLE_TYPE_FLOAT64 && storage.variables[sameIndex].unit != variable.unit
+        ? SimConnectUnit::getConversion(storage.variables[sameIndex].unit.str(), variable.unit.str())
+        : SimConnectUnitConversion()
+    );
+    return;
+  }
+
+  // the type and the index within the type group are resolved once
+  size_t physicalIndex = storage.variables.size();
+  storage.physicalIndexByName.emplace(variable.name.getId(), physicalIndex);
+  storage.variables.push_back(variable);
+  storage.types.push_back(type);
+  storage.typeIndices.push_back(storage.typeCounts[type]);
+  storage.typeCounts[type]++;
+  storage.logicalVariables.push_back(item);
+  storage.physicalIndices.push_back(physicalIndex);
+  storage.conversions.emplace_back();
+}
+
+bool SimConnectDataDefinition::isSameVariable(
+    const Storage &storage,
+    size_t physicalIndex,
+    const SimConnectVariable &item,
+    SIMCONNECT_VARIABLE_TYPE type
+) {
+  // options have to match
+  const auto &physical = storage.variables[physicalIndex];
+  if (storage.types[physicalIndex] != type || physical.isStatic != item.isStatic || physical.priority != item.priority) {
+    return false;
+  }
+
+  // the error bound of adaptive variables is given in the unit of the physical variable
+  if (physical.isAdaptive != item.isAdaptive
+      || physical.adaptiveErrorBound != item.adaptiveErrorBound
+      || (item.adaptiveErrorBound > 0 && physical.unit != item.unit)) {
+    return false;
+  }
+
+  // the unit of structures is not used
+  if (type == SIMCONNECT_VARIABLE_TYPE_LATLONALT || type == SIMCONNECT_VARIABLE_TYPE_XYZ) {
+    return true;
+  }
+
+  // identical units are always shared
+  if (physical.unit == item.unit) {
+    return true;
+  }
+
+  // units missing in the unit table are passed to SimConnect unchanged and never converted
+  if (!SimConnectUnit::isKnown(physical.unit.str()) || !SimConnectUnit::isKnown(item.unit.str())) {
+    return false;
+  }
+
+  // only 64-bit floating point numbers are converted
+  switch (type) {
+    case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
+      return SimConnectUnit::isConvertible(physical.unit.str(), item.unit.str());
+
+    default:
+      return false;
+  }
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include "SimConnectDataFilter.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+size_t SimConnectDataFilter::add(
+    size_t sourceIndex,
+    SimConnectUnitConversion conversion,
+    SIMCONNECT_VARIABLE_FILTER filter,
+    double parameter
+) {
+  // every filter has the parameters of the kernel, moving averages additionally get a slot in the ring buffer
+  double timeConstant = 0;
+  double secondStage = 0;
+  double derivativeWeight = 0;
+  switch (filter) {
+    case SIMCONNECT_VARIABLE_FILTER_LOWPASS:
+      timeConstant = parameter;
+      break;
+    case SIMCONNECT_VARIABLE_FILTER_LOWPASS2:
+      timeConstant = parameter;
+      secondStage = 1;
+      break;
+    case SIMCONNECT_VARIABLE_FILTER_AVERAGE:
+      if (parameter < 1) {
+        throw invalid_argument("Variable filter window not valid!");
+      }
+      averages.push_back({sourceIndices.size(), static_cast<size_t>(parameter), samples.size(), 0, 0, 1 / parameter});
+      samples.resize(samples.size() + averages.back().window, 0);
+      break;
+    case SIMCONNECT_VARIABLE_FILTER_DERIVATIVE:
+      derivativeWeight = 1;
+      break;
+    default:
+      throw invalid_argument("Variable filter not valid!");
+  }
+  if (timeConstant < 0) {
+    throw invalid_argument("Variable filter time constant not valid!");
+  }
+
+  // the index of the filtered value in the target
+  sourceIndices.push_back(sourceIndex);
+  scales.push_back(conversion.scale);
+  offsets.push_back(conversion.offset);
+  timeConstants.push_back(timeConstant);
+  factors.push_back(0);
+  secondStages.push_back(secondStage);
+  derivativeWeights.push_back(derivativeWeight);
+  firstStates.push_back(0);
+  secondStates.push_back(0);
+  inputs.push_back(0);
+  isInitialized = false;
+  factorTimeStep = 0;
+  return sourceIndices.size() - 1;
+}
+
+void SimConnectDataFilter::clear() {
+  sourceIndices.clear();
+  scales.clear();
+  offsets.clear();
+  timeConstants.clear();
+  factors.clear();
+  secondStages.clear();
+  derivativeWeights.clear();
+  firstStates.clear();
+  secondStates.clear();
+  inputs.clear();
+  averages.clear();
+  samples.clear();
+  isInitialized = false;
+}
+
+void SimConnectDataFilter::reset() {
+  // the next frame initializes the filters again
+  isInitialized = false;
+}
+
+size_t SimConnectDataFilter::size() const {
+  return sourceIndices.size();
+}
+
+void SimConnectDataFilter::process(
+    const double *source,
+    double *target,
+    double timeStep
+) {
+  const size_t count = sourceIndices.size();
+  const size_t *indices = sourceIndices.data();
+  const double *scale = scales.data();
+  const double *offset = offsets.data();
+  double *input = inputs.data();
+
+  // gather and convert into the unit of the variable, the loop after the gather is vectorized by the compiler
+  for (size_t kI = 0; kI < count; ++kI) {
+    input[kI] = source[indices[kI]];
+  }
+  for (size_t kI = 0; kI < count; ++kI) {
+    input[kI] = input[kI] * scale[kI] + offset[kI];
+  }
+
+  // the first frame sets the state of all filters
+  if (!isInitialized) {
+    initialize(target);
+    return;
+  }
+
+  // filters only advance with the simulation time, e.g. not while paused
+  if (timeStep <= 0) {
+    return;
+  }
+
+  // the factors of the lowpass filters only change with the frame rate
+  if (timeStep != factorTimeStep) {
+    for (size_t kI = 0; kI < count; ++kI) {
+      factors[kI] = timeStep / (timeConstants[kI] + timeStep);
+    }
+    factorTimeStep = timeStep;
+  }
+
+  // lowpass and derivative filters
+  filter(
+      count,
+      timeStep,
+      input,
+      factors.data(),
+      secondStages.data(),
+      derivativeWeights.data(),
+      firstStates.data(),
+      secondStates.data(),
+      target
+  );
+
+  // moving averages over the last frames, the sum is recalculated once per window against rounding errors
+  for (auto &average : averages) {
+    double *window = samples.data() + average.offset;
+    double value = input[average.index];
+    average.sum += value - window[average.position];
+    window[average.position] = value;
+    if (++average.position == average.window) {
+      average.position = 0;
+      average.sum = accumulate(window, window + average.window, 0.0);
+    }
+    target[average.index] = average.sum * average.scale;
+  }
+}
+
+void SimConnectDataFilter::initialize(
+    double *target
+) {
+  // filters start in the steady state of the first value
+  const size_t count = sourceIndices.size();
+  for (size_t kI = 0; kI < count; ++kI) {
+    firstStates[kI] = inputs[kI];
+    secondStates[kI] = inputs[kI];
+    target[kI] = inputs[kI] * (1 - derivativeWeights[kI]);
+  }
+  for (auto &average : averages) {
+    fill_n(samples.data() + average.offset, average.window, inputs[average.index]);
+    average.position = 0;
+    average.sum = inputs[average.index] * static_cast<double>(average.window);
+  }
+  isInitialized = true;
+}
+
+void SimConnectDataFilter::filter(
+    size_t count,
+    double timeStep,
+    const double *__restrict input,
+    const double *__restrict factor,
+    const double *__restrict secondStage,
+    const double *__restrict derivativeWeight,
+    double *__restrict firstState,
+    double *__restrict secondState,
+    double *__restrict output
+) {
+  // discretized first order lowpass, the second stage is a pass-through for all but second order lowpass filters
+  // and the derivative is the difference to the state of a pass-through first stage
+  const double inverseTimeStep = 1 / timeStep;
+  for (size_t kI = 0; kI < count; ++kI) {
+    double x = input[kI];
+    double derivative = (x - firstState[kI]) * inverseTimeStep;
+    double first = firstState[kI] + factor[kI] * (x - firstState[kI]);
+    double secondFactor = secondStage[kI] * factor[kI] + (1 - secondStage[kI]);
+    double second = secondState[kI] + secondFactor * (first - secondState[kI]);
+    firstState[kI] = first;
+    secondState[kI] = second;
+    output[kI] = derivativeWeight[kI] * derivative + (1 - derivativeWeight[kI]) * second;
+  }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "SimConnectDataHash.h"
+
+#include <cstring>
+#include <emmintrin.h>
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+namespace {
+// odd 64-bit constants, the key of every accumulator is unique per stripe so that moved data changes the hash
+const uint64_t HASH_KEYS[8] = {
+    0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL, 0xdb979083e96dd4deULL, 0x1f67b3b7a4a44072ULL,
+    0x78e5c0cc4ee679cbULL, 0x2172ffcc7dd05a82ULL, 0x8e2443f7744608b8ULL, 0x4c263a81e69035e0ULL
+};
+const uint64_t HASH_PRIME_1 = 0x9e3779b185ebca87ULL;
+const uint64_t HASH_PRIME_2 = 0xc2b2ae3d27d4eb4fULL;
+const uint64_t HASH_PRIME_3 = 0x165667b19e3779f9ULL;
+}
+
+uint64_t SimConnectDataHash::hash(
+    const char *data,
+    size_t size
+) {
+  uint64_t accumulators[ACCUMULATOR_COUNT] = {
+      HASH_PRIME_1, HASH_PRIME_2, HASH_PRIME_3, HASH_PRIME_1 ^ HASH_PRIME_2,
+      HASH_PRIME_2 ^ HASH_PRIME_3, HASH_PRIME_1 ^ HASH_PRIME_3, ~HASH_PRIME_1, ~HASH_PRIME_2
+  };
+
+  // whole stripes are read directly from the buffer
+  size_t stripeCount = size / STRIPE_SIZE;
+  accumulate(accumulators, data, 0, stripeCount);
+
+  // the remaining bytes are padded with zeros, the size is part of the result
+  size_t position = stripeCount * STRIPE_SIZE;
+  if (position < size) {
+    char stripe[STRIPE_SIZE] = {};
+    memcpy(stripe, data + position, size - position);
+    accumulate(accumulators, stripe, stripeCount, 1);
+  }
+
+  // merge accumulators
+  uint64_t result = static_cast<uint64_t>(size) * HASH_PRIME_1;
+  for (size_t kI = 0; kI < ACCUMULATOR_COUNT; ++kI) {
+    result = (result ^ avalanche(accumulators[kI])) * HASH_PRIME_2 + HASH_PRIME_3;
+  }
+  return avalanche(result);
+}
+
+void SimConnectDataHash::accumulate(
+    uint64_t *__restrict accumulators,
+    const char *__restrict stripes,
+    uint64_t firstStripe,
+    size_t stripeCount
+) {
+  // independent lanes with 32 x 32 -> 64 bit products, SSE2 is always available on x64
+  __m128i lanes[ACCUMULATOR_COUNT / 2];
+  __m128i keys[ACCUMULATOR_COUNT / 2];
+  for (size_t kI = 0; kI < ACCUMULATOR_COUNT / 2; ++kI) {
+    lanes[kI] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(accumulators) + kI);
+    keys[kI] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(HASH_KEYS) + kI);
+  }
+  for (size_t kStripe = 0; kStripe < stripeCount; ++kStripe) {
+    const auto *stripe = reinterpret_cast<const __m128i *>(stripes + kStripe * STRIPE_SIZE);
+    const __m128i stripeKey = _mm_set1_epi64x(static_cast<long long>((firstStripe + kStripe) * HASH_PRIME_1));
+    for (size_t kI = 0; kI < ACCUMULATOR_COUNT / 2; ++kI) {
+      __m128i words = _mm_loadu_si128(stripe + kI);
+      __m128i key = _mm_xor_si128(words, _mm_add_epi64(keys[kI], stripeKey));
+      __m128i product = _mm_mul_epu32(key, _mm_srli_epi64(key, 32));
+      lanes[kI] = _mm_add_epi64(lanes[kI], _mm_add_epi64(words, product));
+    }
+  }
+  for (size_t kI = 0; kI < ACCUMULATOR_COUNT / 2; ++kI) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(accumulators) + kI, lanes[kI]);
+  }
+}
+
+uint64_t SimConnectDataHash::avalanche(
+    uint64_t value
+) {
+  value ^= value >> 33;
+  value *= HASH_PRIME_2;
+  value ^= value >> 29;
+  value *= HASH_PRIME_3;
+  value ^= value >> 32;
+  return value;
+}
@@ -14,6 +14,7 @@
  *     limitations under the License.
  */
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include "SimConnectDataInterface.h"
@@ -21,41 +22,86 @@
 using namespace std;
 using namespace simconnect::toolbox::connection;
 
+SimConnectDataInterface::SimConnectDataInterface(
+    pmr::memory_resource *resource
+) : definition(resource),
+    memoryResource(resource),
+    updateIntervals(resource),
+    chunks(resource),
+    chunkPending(resource),
+    frameBuffer(resource),
+    sendBuffer(resource),
+    staticSegments(resource),
+    staticFrameBuffer(resource) {
+}
+
 bool SimConnectDataInterface::connect(
     int configurationIndex,
     const string &name,
     const SimConnectDataDefinition &dataDefinition,
-    const shared_ptr<SimConnectData> &simConnectData
+    const shared_ptr<SimConnectData> &simConnectData,
+    size_t maximumChunkSize
 ) {
   // store connection name
   connectionName = name;
 
+  // the event is signaled by SimConnect whenever a message is waiting, so clients can wait instead of polling
+  hDispatchEvent = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+
   // connect
   HRESULT result = SimConnect_Open(
       &hSimConnect,
       connectionName.c_str(),
       nullptr,
       0,
-      nullptr,
+      hDispatchEvent,
       configurationIndex
   );
 
   if (S_OK == result) {
     // we are now connected
     isConnected = true;
-    // store data object
+    // store definition and data object
+    chunkSize = maximumChunkSize;
+    definition = dataDefinition;
+    nextDefinitionId = 0;
+    updateIntervals.clear();
+    requestCount = 0;
     this->data = simConnectData;
-    // add data to definition
-    if (!prepareDataDefinition(hSimConnect, 0, dataDefinition)) {
+    // split definition into chunks and add data to definition
+    chunks.clear();
+    if (!replaceDataChunks(getDataChunks(definition, *data, chunkSize, memoryResource))) {
       // failed to add data definition -> disconnect
       disconnect();
       // failed to connect
       return false;
     }
+    resetFrame();
+    // subscribe to system events registered before connecting, the event id is the index into the table
+    for (size_t event = 0; event < systemEvents.size(); ++event) {
+      if (!systemEvents[event].isSubscribed) {
+        continue;
+      }
+      result = SimConnect_SubscribeToSystemEvent(
+          hSimConnect,
+          static_cast<SIMCONNECT_CLIENT_EVENT_ID>(event),
+          SimConnectSystemEvent::getName(static_cast<SIMCONNECT_SYSTEM_EVENT>(event))
+      );
+      if (result != S_OK) {
+        // failed to subscribe -> disconnect
+        disconnect();
+        // failed to connect
+        return false;
+      }
+    }
     // success
     return true;
   }
   // fallback -> failed
+  if (hDispatchEvent) {
+    CloseHandle(hDispatchEvent);
+    hDispatchEvent = nullptr;
+  }
   return false;
 }
 
@@ -65,44 +111,166 @@ void SimConnectDataInterface::disconnect() {
     SimConnect_Close(hSimConnect);
     // set flag
     isConnected = false;
-    // reset data object
+    // reset definition and data object
+    definition = SimConnectDataDefinition(memoryResource);
+    chunks.clear();
+    resetFrame();
     data.reset();
-    // reset handle
+    staticData.reset();
+    isPaused = false;
+    isSimRunning = false;
+    isCrashed = false;
+    // event counts start again with the next connection, subscriptions are kept
+    for (auto &subscription : systemEvents) {
+      subscription.count = 0;
+    }
+    // reset handles
     hSimConnect = nullptr;
+    if (hDispatchEvent) {
+      CloseHandle(hDispatchEvent);
+      hDispatchEvent = nullptr;
+    }
   }
 }
 
-bool SimConnectDataInterface::requestReadData() {
+bool SimConnectDataInterface::isOpen() const {
+  return isConnected;
+}
+
+HANDLE SimConnectDataInterface::getDispatchEvent() const {
+  return hDispatchEvent;
+}
+
+bool SimConnectDataInterface::reconfigure(
+    const SimConnectDataDefinition &dataDefinition,
+    const shared_ptr<SimConnectData> &simConnectData
+) {
+  // check if we are connected
+  if (!isConnected || !simConnectData) {
+    return false;
+  }
+
+  // nothing to register when the variables did not change
+  if (dataDefinition == definition) {
+    if (data && data != simConnectData) {
+      simConnectData->carryOver(*data);
+    }
+    data = simConnectData;
+    return true;
+  }
+
+  // only chunks with changed variables are registered again, on failure the current data object stays untouched
+  if (!replaceDataChunks(getDataChunks(dataDefinition, *simConnectData, chunkSize, memoryResource))) {
+    return false;
+  }
+
+  // carry over values of variables that are kept
+  if (data && data != simConnectData) {
+    simConnectData->carryOver(*data);
+  }
+
+  // switch over, update intervals are not valid for the new variables
+  definition = dataDefinition;
+  data = simConnectData;
+  updateIntervals.clear();
+  if (updateRateScheduler) {
+    updateRateScheduler->reset(definition.size());
+  }
+  resetFrame();
+
+  // success
+  return true;
+}
+
+bool SimConnectDataInterface::setUpdateIntervals(
+    const vector<size_t> &intervals
+) {
   // check if we are connected
   if (!isConnected) {
     return false;
   }
 
-  // request data
-  if (!requestData()) {
+  // there has to be an interval for every variable
+  if (intervals.size() != definition.size()) {
     return false;
   }
 
-  // read data
-  if (!readData()) {
+  // nothing to do when the partition did not change
+  if (equal(intervals.begin(), intervals.end(), updateIntervals.begin(), updateIntervals.end())) {
+    return true;
+  }
+
+  // register the new partition
+  if (!replaceDataChunks(getDataChunks(definition, *data, chunkSize, memoryResource, intervals))) {
     return false;
   }
+  updateIntervals.assign(intervals.begin(), intervals.end());
+  resetFrame();
 
   // success
   return true;
 }
 
-bool SimConnectDataInterface::requestData() {
+void SimConnectDataInterface::setUpdateRateScheduler(
+    const shared_ptr<SimConnectUpdateRateScheduler> &scheduler
+) {
+  updateRateScheduler = scheduler;
+  if (updateRateScheduler) {
+    updateRateScheduler->reset(definition.size());
+  }
+}
+
+bool SimConnectDataInterface::setStaticData(
+    const SimConnectDataDefinition &dataDefinition,
+    const shared_ptr<SimConnectData> &simConnectData
+) {
   // check if we are connected
-  if (!isConnected) {
+  if (!isConnected || !simConnectData) {
+    return false;
+  }
+
+  // replace a previous static definition
+  if (staticData) {
+    SimConnect_ClearDataDefinition(hSimConnect, STATIC_DEFINITION_ID);
+    staticData.reset();
+  }
+
+  // register static variables in their own definition, without chunk size limit they form a single chunk
+  auto staticChunks = getDataChunks(dataDefinition, *simConnectData, 0, memoryResource);
+  if (staticChunks.size() != 1 || staticChunks.front().size == 0) {
+    return false;
+  }
+  if (!prepareDataDefinition(hSimConnect, STATIC_DEFINITION_ID, staticChunks.front().variables)) {
+    SimConnect_ClearDataDefinition(hSimConnect, STATIC_DEFINITION_ID);
+    return false;
+  }
+  staticSegments.assign(staticChunks.front().segments.begin(), staticChunks.front().segments.end());
+  staticFrameBuffer.assign(simConnectData->size(), 0);
+  staticData = simConnectData;
+
+  // static variables only change when another aircraft or flight is loaded
+  if (!subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_AIRCRAFT_LOADED)) {
+    return false;
+  }
+  if (!subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_FLIGHT_LOADED)) {
+    return false;
+  }
+
+  // read them once
+  return requestStaticData();
+}
+
+bool SimConnectDataInterface::requestStaticData() {
+  // check if we are connected and have static data
+  if (!isConnected || !staticData) {
     return false;
   }
 
   // request data
   HRESULT result = SimConnect_RequestDataOnSimObjectType(
       hSimConnect,
-      0,
-      0,
+      STATIC_DEFINITION_ID,
+      STATIC_DEFINITION_ID,
       0,
       SIMCONNECT_SIMOBJECT_TYPE_USER
   );
@@ -117,6 +285,166 @@ bool SimConnectDataInterface::requestData() {
   return true;
 }
 
+bool SimConnectDataInterface::subscribeToSystemEvent(
+    SIMCONNECT_SYSTEM_EVENT event,
+    const function<void(const SIMCONNECT_RECV_EVENT *)> &callback
+) {
+  // check event
+  if (event >= SIMCONNECT_SYSTEM_EVENT_COUNT) {
+    return false;
+  }
+
+  // keep an existing callback when none is given
+  auto &subscription = systemEvents[event];
+  if (callback) {
+    subscription.callback = callback;
+  }
+
+  // subscribe when connected, otherwise this happens on connect
+  if (isConnected && !subscription.isSubscribed) {
+    HRESULT result = SimConnect_SubscribeToSystemEvent(
+        hSimConnect,
+        static_cast<SIMCONNECT_CLIENT_EVENT_ID>(event),
+        SimConnectSystemEvent::getName(event)
+    );
+    if (result != S_OK) {
+      return false;
+    }
+  }
+  subscription.isSubscribed = true;
+
+  // success
+  return true;
+}
+
+bool SimConnectDataInterface::unsubscribeFromSystemEvent(
+    SIMCONNECT_SYSTEM_EVENT event
+) {
+  // check event
+  if (event >= SIMCONNECT_SYSTEM_EVENT_COUNT) {
+    return false;
+  }
+
+  // unsubscribe when connected
+  auto &subscription = systemEvents[event];
+  if (isConnected && subscription.isSubscribed) {
+    HRESULT result = SimConnect_UnsubscribeFromSystemEvent(
+        hSimConnect,
+        static_cast<SIMCONNECT_CLIENT_EVENT_ID>(event)
+    );
+    if (result != S_OK) {
+      return false;
+    }
+  }
+  subscription.isSubscribed = false;
+  subscription.callback = nullptr;
+
+  // success
+  return true;
+}
+
+bool SimConnectDataInterface::subscribeToSystemState() {
+  // events needed to derive the system state
+  return subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_PAUSE)
+      && subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_SIM)
+      && subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_CRASHED)
+      && subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_CRASH_RESET)
+      && subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_AIRCRAFT_LOADED)
+      && subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_FLIGHT_LOADED);
+}
+
+void SimConnectDataInterface::setFrameCallback(
+    const function<void()> &callback
+) {
+  frameCallback = callback;
+}
+
+void SimConnectDataInterface::setEventCallback(
+    const function<void(const SIMCONNECT_RECV_EVENT *)> &callback
+) {
+  eventCallback = callback;
+}
+
+unsigned long long SimConnectDataInterface::getSystemEventCount(
+    SIMCONNECT_SYSTEM_EVENT event
+) const {
+  if (event >= SIMCONNECT_SYSTEM_EVENT_COUNT) {
+    return 0;
+  }
+  return systemEvents[event].count;
+}
+
+SimConnectSystemState SimConnectDataInterface::getSystemState() const {
+  SimConnectSystemState state;
+  state.isPaused = isPaused;
+  state.isSimRunning = isSimRunning;
+  state.isCrashed = isCrashed;
+  state.aircraftLoadCount = systemEvents[SIMCONNECT_SYSTEM_EVENT_AIRCRAFT_LOADED].count;
+  state.flightLoadCount = systemEvents[SIMCONNECT_SYSTEM_EVENT_FLIGHT_LOADED].count;
+  return state;
+}
+
+bool SimConnectDataInterface::requestReadData() {
+  // check if we are connected
+  if (!isConnected) {
+    return false;
+  }
+
+  // request data
+  if (!requestData()) {
+    return false;
+  }
+
+  // read data
+  if (!readData()) {
+    return false;
+  }
+
+  // success
+  return true;
+}
+
+bool SimConnectDataInterface::requestData() {
+  // check if we are connected
+  if (!isConnected) {
+    return false;
+  }
+
+  // request data of every chunk that is due, the request id equals the definition id
+  requestedSize = 0;
+  requestTime = chrono::steady_clock::now();
+  for (size_t index = 0; index < chunks.size(); ++index) {
+    // nothing to request for an empty definition or when the chunk is not due
+    if (chunks[index].size == 0 || requestCount % chunks[index].interval != 0) {
+      continue;
+    }
+    HRESULT result = SimConnect_RequestDataOnSimObjectType(
+        hSimConnect,
+        chunks[index].id,
+        chunks[index].id,
+        0,
+        SIMCONNECT_SIMOBJECT_TYPE_USER
+    );
+
+    // check result of data request
+    if (result != S_OK) {
+      // request failed
+      return false;
+    }
+
+    // wait for chunk
+    if (!chunkPending[index]) {
+      chunkPending[index] = true;
+      chunkPendingCount++;
+    }
+    requestedSize += chunks[index].size;
+  }
+  requestCount++;
+
+  // success
+  return true;
+}
+
 bool SimConnectDataInterface::readData() {
   // check if we are connected
   if (!isConnected) {
@@ -140,27 +468,68 @@ bool SimConnectDataInterface::sendData() {
     return false;
   }
 
-  // set output data
-  HRESULT result = SimConnect_SetDataOnSimObject(
-      hSimConnect,
-      0,
-      SIMCONNECT_OBJECT_ID_USER,
-      0,
-      0,
-      static_cast<DWORD>(data->size()),
-      data->getBuffer()
-  );
+  // set output data of every chunk
+  for (size_t index = 0; index < chunks.size(); ++index) {
+    // nothing to send for an empty definition
+    if (chunks[index].size == 0) {
+      continue;
+    }
 
-  // check result of data request
-  if (result != S_OK) {
-    // request failed
-    return false;
+    // gather chunk data when it is spread over the buffer
+    char *chunkData = data->getBuffer() + chunks[index].segments.front().offset;
+    if (chunks[index].segments.size() > 1) {
+      sendBuffer.resize(chunks[index].size);
+      chunkData = sendBuffer.data();
+      for (const auto &segment : chunks[index].segments) {
+        std::copy_n(data->getBuffer() + segment.offset, segment.size, chunkData);
+        chunkData += segment.size;
+      }
+      chunkData = sendBuffer.data();
+    }
+
+    HRESULT result = SimConnect_SetDataOnSimObject(
+        hSimConnect,
+        chunks[index].id,
+        SIMCONNECT_OBJECT_ID_USER,
+        0,
+        0,
+        static_cast<DWORD>(chunks[index].size),
+        chunkData
+    );
+
+    // check result of data request
+    if (result != S_OK) {
+      // request failed
+      return false;
+    }
   }
 
   // success
   return true;
 }
 
+unsigned long long SimConnectDataInterface::getFrameCount() const {
+  return frameCount;
+}
+
+size_t SimConnectDataInterface::getRequestedSize() const {
+  return requestedSize;
+}
+
+void SimConnectDataInterface::setLatencyBudget(
+    chrono::microseconds budget
+) {
+  latencyBudget = budget;
+}
+
+chrono::microseconds SimConnectDataInterface::getLatency() const {
+  return latency;
+}
+
+unsigned long long SimConnectDataInterface::getLatencyBudgetExceededCount() const {
+  return latencyBudgetExceededCount;
+}
+
 void SimConnectDataInterface::simConnectProcessDispatchMessage(
     SIMCONNECT_RECV *pData,
     DWORD *cbData
@@ -168,7 +537,8 @@ void SimConnectDataInterface::simConnectProcessDispatchMessage(
   switch (pData->dwID) {
     case SIMCONNECT_RECV_ID_OPEN:
       // connection established
-      cout << "SimConnect connection established ('" << connectionName << "')" << endl;
+      cout << "SimConnect connection established ('" << connectionName << "', ";
+      cout << definition.size() << " of " << definition.getLogicalSize() << " variables requested)" << endl;
       break;
 
     case SIMCONNECT_RECV_ID_QUIT:
@@ -182,6 +552,13 @@ void SimConnectDataInterface::simConnectProcessDispatchMessage(
       simConnectProcessSimObjectDataByType(pData);
       break;
 
+    case SIMCONNECT_RECV_ID_EVENT:
+    case SIMCONNECT_RECV_ID_EVENT_FILENAME:
+    case SIMCONNECT_RECV_ID_EVENT_FRAME:
+      // process system event
+      simConnectProcessSystemEvent(pData);
+      break;
+
     case SIMCONNECT_RECV_ID_EXCEPTION:
       // exception
       cout << "Exception in SimConnect connection ('" << connectionName << "'): ";
@@ -199,80 +576,291 @@ void SimConnectDataInterface::simConnectProcessSimObjectDataByType(
   // get data object
   auto *simObjectDataByType = (SIMCONNECT_RECV_SIMOBJECT_DATA_BYTYPE *) pData;
 
-  // process depending on request id
-  switch (simObjectDataByType->dwRequestID) {
-    case 0:
-      // store aircraft data
-      data->copy(reinterpret_cast<char *>(&simObjectDataByType->dwData));
+  // static data is kept until the next load event
+  if (simObjectDataByType->dwRequestID == STATIC_DEFINITION_ID) {
+    if (staticData) {
+      // the reply is packed, it is scattered into the layout of the data object
+      auto *chunkData = reinterpret_cast<const char *>(&simObjectDataByType->dwData);
+      for (const auto &segment : staticSegments) {
+        std::copy_n(chunkData, segment.size, staticFrameBuffer.data() + segment.offset);
+        chunkData += segment.size;
+      }
+      staticData->copy(staticFrameBuffer.data());
+    }
+    return;
+  }
+
+  // get chunk from request id
+  auto chunkIt = find_if(chunks.begin(), chunks.end(), [simObjectDataByType](const DataChunk &chunk) {
+    return chunk.id == simObjectDataByType->dwRequestID;
+  });
+  if (chunkIt == chunks.end()) {
+    // older request ids belong to a chunk replaced by reconfigure -> drop data
+    if (simObjectDataByType->dwRequestID < nextDefinitionId) {
+      return;
+    }
+    // print unknown request id
+    cout << "Unknown request id in SimConnect connection ('" << connectionName << "'): ";
+    cout << simObjectDataByType->dwRequestID << endl;
+    return;
+  }
+
+  // a single chunk covering the whole buffer is always a whole frame -> store aircraft data
+  size_t index = static_cast<size_t>(chunkIt - chunks.begin());
+  auto &chunk = *chunkIt;
+  if (chunks.size() == 1 && chunk.segments.size() == 1 && chunk.size == data->size()) {
+    data->copy(reinterpret_cast<char *>(&simObjectDataByType->dwData));
+    chunkPending[index] = false;
+    chunkPendingCount = 0;
+    publishFrame();
+    return;
+  }
+
+  // scatter chunk into frame buffer
+  auto *chunkData = reinterpret_cast<const char *>(&simObjectDataByType->dwData);
+  for (const auto &segment : chunk.segments) {
+    std::copy_n(chunkData, segment.size, frameBuffer.data() + segment.offset);
+    chunkData += segment.size;
+  }
+  if (!chunkPending[index]) {
+    // chunk was not requested in this round
+    return;
+  }
+  chunkPending[index] = false;
+  chunkPendingCount--;
+
+  // publish frame only when all requested chunks are there
+  if (chunkPendingCount == 0) {
+    data->copy(frameBuffer.data());
+    publishFrame();
+  }
+}
+
+void SimConnectDataInterface::simConnectProcessSystemEvent(
+    const SIMCONNECT_RECV *pData
+) {
+  // get event, the event id is the index into the subscription table
+  auto *event = (SIMCONNECT_RECV_EVENT *) pData;
+  if (event->uEventID >= systemEvents.size()) {
+    return;
+  }
+  auto &subscription = systemEvents[event->uEventID];
+  subscription.count++;
+
+  // update derived state
+  switch (event->uEventID) {
+    case SIMCONNECT_SYSTEM_EVENT_PAUSE:
+      isPaused = event->dwData != 0;
+      break;
+
+    case SIMCONNECT_SYSTEM_EVENT_SIM:
+      isSimRunning = event->dwData != 0;
+      break;
+
+    case SIMCONNECT_SYSTEM_EVENT_CRASHED:
+      isCrashed = true;
+      break;
+
+    case SIMCONNECT_SYSTEM_EVENT_CRASH_RESET:
+      isCrashed = false;
+      break;
+
+    case SIMCONNECT_SYSTEM_EVENT_AIRCRAFT_LOADED:
+    case SIMCONNECT_SYSTEM_EVENT_FLIGHT_LOADED:
+      // static data needs to be read again after a load
+      if (staticData) {
+        requestStaticData();
+      }
       break;
 
     default:
-      // print unknown request id
-      cout << "Unknown request id in SimConnect connection ('" << connectionName << "'): ";
-      cout << simObjectDataByType->dwRequestID << endl;
       break;
   }
+
+  // notify subscriber and observer of all events
+  if (subscription.callback) {
+    subscription.callback(event);
+  }
+  if (eventCallback) {
+    eventCallback(event);
+  }
 }
 
-bool SimConnectDataInterface::prepareDataDefinition(
-    HANDLE connectionHandle,
-    SIMCONNECT_DATA_DEFINITION_ID id,
-    SimConnectDataDefinition dataDefinition
+void SimConnectDataInterface::resetFrame() {
+  chunkPending.assign(chunks.size(), false);
+  chunkPendingCount = 0;
+  frameBuffer.assign(data ? data->size() : 0, 0);
+  if (data) {
+    std::copy_n(data->getBuffer(), data->size(), frameBuffer.data());
+  }
+}
+
+void SimConnectDataInterface::publishFrame() {
+  frameCount++;
+
+  // latency from request to complete frame
+  latency = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - requestTime);
+  if (latencyBudget > chrono::microseconds::zero() && latency > latencyBudget) {
+    latencyBudgetExceededCount++;
+  }
+
+  // let the scheduler observe the frame and move variables between update intervals
+  if (updateRateScheduler && updateRateScheduler->update(definition, *data)) {
+    setUpdateIntervals(updateRateScheduler->getIntervals());
+  }
+
+  // notify observer
+  if (frameCallback) {
+    frameCallback();
+  }
+}
+
+bool SimConnectDataInterface::replaceDataChunks(
+    pmr::vector<DataChunk> &&dataChunks
 ) {
-  // map for right order of data definitions
-  map<SIMCONNECT_VARIABLE_TYPE, vector<SimConnectVariable>> dataDefinitionMap;
-  for (int i = 0; i < dataDefinition.size(); ++i) {
-    dataDefinitionMap[dataDefinition.getType(i)].push_back(dataDefinition.get(i));
-  }
-
-  // add data definitions
-  bool result = addDataDefinition(
-      connectionHandle,
-      id,
-      SIMCONNECT_VARIABLE_TYPE_BOOL,
-      dataDefinitionMap[SIMCONNECT_VARIABLE_TYPE_BOOL]
-  );
-  if (!result) return false;
+  // chunks with unchanged variables keep their definition, all others are registered under fresh ids
+  SIMCONNECT_DATA_DEFINITION_ID firstId = nextDefinitionId;
+  pmr::vector<bool> isKept(chunks.size(), false, memoryResource);
+  for (auto &chunk : dataChunks) {
+    auto kept = find_if(chunks.begin(), chunks.end(), [&](const DataChunk &current) {
+      return !isKept[&current - chunks.data()] && isSameDefinition(current.variables, chunk.variables);
+    });
+    if (kept != chunks.end()) {
+      chunk.id = kept->id;
+      isKept[kept - chunks.begin()] = true;
+      continue;
+    }
+    chunk.id = nextDefinitionId++;
+    if (!prepareDataDefinition(hSimConnect, chunk.id, chunk.variables)) {
+      // remove what was registered so far and keep the current chunks
+      clearDataChunks(hSimConnect, firstId, nextDefinitionId - firstId);
+      nextDefinitionId = firstId;
+      return false;
+    }
+  }
 
-  result = addDataDefinition(
-      connectionHandle,
-      id,
-      SIMCONNECT_VARIABLE_TYPE_INT32,
-      dataDefinitionMap[SIMCONNECT_VARIABLE_TYPE_INT32]
-  );
-  if (!result) return false;
+  // the replaced definitions are not needed anymore, responses to their request ids are dropped from now on
+  for (size_t index = 0; index < chunks.size(); ++index) {
+    if (!isKept[index]) {
+      SimConnect_ClearDataDefinition(hSimConnect, chunks[index].id);
+    }
+  }
+  chunks = std::move(dataChunks);
 
-  result = addDataDefinition(
-      connectionHandle,
-      id,
-      SIMCONNECT_VARIABLE_TYPE_FLOAT32,
-      dataDefinitionMap[SIMCONNECT_VARIABLE_TYPE_FLOAT32]
-  );
-  if (!result) return false;
+  // success
+  return true;
+}
 
-  result = addDataDefinition(
-      connectionHandle,
-      id,
-      SIMCONNECT_VARIABLE_TYPE_FLOAT64,
-      dataDefinitionMap[SIMCONNECT_VARIABLE_TYPE_FLOAT64]
-  );
-  if (!result) return false;
+pmr::vector<SimConnectDataInterface::DataChunk> SimConnectDataInterface::getDataChunks(
+    SimConnectDataDefinition dataDefinition,
+    SimConnectData &simConnectData,
+    size_t maximumChunkSize,
+    pmr::memory_resource *resource,
+    const vector<size_t> &intervals
+) {
+  // map of update interval to variable indices in the right order of data definitions
+  pmr::map<size_t, pmr::map<SIMCONNECT_VARIABLE_TYPE, pmr::vector<size_t>>> dataDefinitionMap(resource);
+  for (size_t i = 0; i < dataDefinition.size(); ++i) {
+    size_t interval = i < intervals.size() ? max<size_t>(1, intervals[i]) : 1;
+    dataDefinitionMap[interval][dataDefinition.getType(i)].push_back(i);
+  }
 
-  result = addDataDefinition(
-      connectionHandle,
-      id,
-      SIMCONNECT_VARIABLE_TYPE_LATLONALT,
-      dataDefinitionMap[SIMCONNECT_VARIABLE_TYPE_LATLONALT]
-  );
-  if (!result) return false;
+  // no limit, a single interval and the packed layout -> one chunk covering the whole buffer
+  if (maximumChunkSize == 0 && dataDefinitionMap.size() <= 1 && simConnectData.getLayout().isDefault()) {
+    DataChunk chunk(resource);
+    for (const auto &[interval, types] : dataDefinitionMap) {
+      for (const auto &[type, indices] : types) {
+        for (auto index : indices) {
+          chunk.variables[type].push_back(dataDefinition.get(index));
+        }
+      }
+      chunk.interval = interval;
+    }
+    chunk.segments.push_back({0, simConnectData.size()});
+    chunk.size = simConnectData.size();
+    pmr::vector<DataChunk> dataChunks(resource);
+    dataChunks.push_back(std::move(chunk));
+    return dataChunks;
+  }
+
+  // every update interval gets its own chunks not exceeding the maximum size, padding of aligned groups is skipped
+  pmr::vector<DataChunk> dataChunks(resource);
+  for (const auto &[interval, types] : dataDefinitionMap) {
+    DataChunk chunk(resource);
+    chunk.interval = interval;
+    for (const auto &[type, indices] : types) {
+      size_t elementSize = SimConnectVariableType::getSize(type);
+      for (auto index : indices) {
+        // start a new chunk when the variable does not fit anymore
+        if (maximumChunkSize > 0 && chunk.size > 0 && chunk.size + elementSize > maximumChunkSize) {
+          dataChunks.push_back(std::move(chunk));
+          chunk = DataChunk(resource);
+          chunk.interval = interval;
+        }
+
+        // add variable and extend segment when it is adjacent in the buffer
+        size_t offset = simConnectData.getVariableOffset(index);
+        chunk.variables[type].push_back(dataDefinition.get(index));
+        if (!chunk.segments.empty() && chunk.segments.back().offset + chunk.segments.back().size == offset) {
+          chunk.segments.back().size += elementSize;
+        } else {
+          chunk.segments.push_back({offset, elementSize});
+        }
+        chunk.size += elementSize;
+      }
+    }
+    if (chunk.size > 0) {
+      dataChunks.push_back(std::move(chunk));
+    }
+  }
+
+  // return result
+  return dataChunks;
+}
 
-  result = addDataDefinition(
-      connectionHandle,
-      id,
-      SIMCONNECT_VARIABLE_TYPE_XYZ,
-      dataDefinitionMap[SIMCONNECT_VARIABLE_TYPE_XYZ]
+bool SimConnectDataInterface::isSameDefinition(
+    const VariableMap &variables,
+    const VariableMap &otherVariables
+) {
+  // a registered definition only depends on name, unit and type of its variables in order
+  return equal(
+      variables.begin(), variables.end(), otherVariables.begin(), otherVariables.end(),
+      [](const auto &entry, const auto &otherEntry) {
+        return entry.first == otherEntry.first && equal(
+            entry.second.begin(), entry.second.end(), otherEntry.second.begin(), otherEntry.second.end(),
+            [](const SimConnectVariable &variable, const SimConnectVariable &otherVariable) {
+              return variable.name == otherVariable.name && variable.unit == otherVariable.unit;
+            }
+        );
+      }
   );
-  if (!result) return false;
+}
+
+void SimConnectDataInterface::clearDataChunks(
+    HANDLE connectionHandle,
+    SIMCONNECT_DATA_DEFINITION_ID firstId,
+    size_t count
+) {
+  for (size_t index = 0; index < count; ++index) {
+    SimConnect_ClearDataDefinition(connectionHandle, firstId + static_cast<DWORD>(index));
+  }
+}
+
+bool SimConnectDataInterface::prepareDataDefinition(
+    HANDLE connectionHandle,
+    SIMCONNECT_DATA_DEFINITION_ID id,
+    const VariableMap &variables
+) {
+  // add data definitions, the map is ordered like the groups in the data buffer
+  for (const auto &[type, typeVariables] : variables) {
+    bool result = addDataDefinition(
+        connectionHandle,
+        id,
+        type,
+        typeVariables
+    );
+    if (!result) return false;
+  }
 
   // success
   return true;
@@ -282,14 +870,16 @@ bool SimConnectDataInterface::addDataDefinition(
     HANDLE connectionHandle,
     SIMCONNECT_DATA_DEFINITION_ID id,
     SIMCONNECT_VARIABLE_TYPE dataType,
-    const vector<SimConnectVariable> &variables
+    const pmr::vector<SimConnectVariable> &variables
 ) {
   for (auto &variable : variables) {
     HRESULT result = SimConnect_AddToDataDefinition(
         connectionHandle,
         id,
         variable.name.c_str(),
-        SimConnectVariableType::isStruct(dataType) ? nullptr : variable.unit.c_str(),
+        SimConnectVariableType::isStruct(dataType) || SimConnectVariableType::isString(dataType)
+        ? nullptr
+        : variable.unit.c_str(),
         SimConnectVariableType::convert(dataType)
     );
     if (result != S_OK) {
@@ -0,0 +1,183 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include "SimConnectDataObserver.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+size_t SimConnectDataObserver::add(
+    const SimConnectDataDefinition &dataDefinition,
+    size_t index,
+    SIMCONNECT_VARIABLE_TRIGGER trigger,
+    double threshold,
+    const Callback &callback
+) {
+  // values are gathered from their type group, only scalar variables can be observed
+  Gather *list = nullptr;
+  switch (dataDefinition.getType(index)) {
+    case SIMCONNECT_VARIABLE_TYPE_BOOL:
+      list = &gatherBoolean;
+      break;
+    case SIMCONNECT_VARIABLE_TYPE_INT32:
+      list = &gatherInt32;
+      break;
+    case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
+      list = &gatherFloat32;
+      break;
+    case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
+      list = &gatherFloat64;
+      break;
+    default:
+      throw invalid_argument("Variable type can not be observed!");
+  }
+  if (trigger == SIMCONNECT_VARIABLE_TRIGGER_NONE) {
+    throw invalid_argument("Variable trigger not valid!");
+  }
+
+  // the index of the trigger
+  list->sources.push_back(dataDefinition.getTypeIndex(index));
+  list->targets.push_back(triggers.size());
+  triggers.push_back(static_cast<uint8_t>(trigger));
+  thresholds.push_back(threshold);
+  values.push_back(0);
+  previousValues.push_back(0);
+  referenceValues.push_back(0);
+  hasValue.push_back(0);
+  fired.push_back(0);
+  callbacks.push_back(callback);
+  return triggers.size() - 1;
+}
+
+void SimConnectDataObserver::clear() {
+  triggers.clear();
+  thresholds.clear();
+  values.clear();
+  previousValues.clear();
+  referenceValues.clear();
+  hasValue.clear();
+  fired.clear();
+  callbacks.clear();
+  for (auto *list : {&gatherBoolean, &gatherInt32, &gatherFloat32, &gatherFloat64}) {
+    list->sources.clear();
+    list->targets.clear();
+  }
+}
+
+void SimConnectDataObserver::reset() {
+  // the next frame is the first value again and does not fire
+  fill(hasValue.begin(), hasValue.end(), 0);
+  fill(fired.begin(), fired.end(), 0);
+}
+
+size_t SimConnectDataObserver::size() const {
+  return triggers.size();
+}
+
+template<typename T>
+void SimConnectDataObserver::gather(
+    SimConnectSpan<const T> group,
+    const Gather &list
+) {
+  const size_t count = list.sources.size();
+  for (size_t kI = 0; kI < count; ++kI) {
+    values[list.targets[kI]] = static_cast<double>(group[list.sources[kI]]);
+  }
+}
+
+size_t SimConnectDataObserver::evaluate(
+    const SimConnectData &data
+) {
+  // gather values of all observed variables
+  gather(data.getGroup<SIMCONNECT_VARIABLE_TYPE_BOOL>(), gatherBoolean);
+  gather(data.getGroup<SIMCONNECT_VARIABLE_TYPE_INT32>(), gatherInt32);
+  gather(data.getGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT32>(), gatherFloat32);
+  gather(data.getGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT64>(), gatherFloat64);
+
+  // evaluate all predicates in one pass
+  const size_t count = triggers.size();
+  size_t firedCount = evaluateTriggers(
+      count,
+      triggers.data(),
+      thresholds.data(),
+      values.data(),
+      previousValues.data(),
+      referenceValues.data(),
+      hasValue.data(),
+      fired.data()
+  );
+
+  // only callbacks of fired triggers are invoked
+  if (firedCount > 0) {
+    for (size_t kI = 0; kI < count; ++kI) {
+      if (fired[kI] != 0 && callbacks[kI]) {
+        callbacks[kI](kI, values[kI]);
+      }
+    }
+  }
+
+  // return number of fired triggers
+  return firedCount;
+}
+
+size_t SimConnectDataObserver::evaluateTriggers(
+    size_t count,
+    const uint8_t *__restrict trigger,
+    const double *__restrict threshold,
+    const double *__restrict value,
+    double *__restrict previous,
+    double *__restrict reference,
+    uint8_t *__restrict initialized,
+    uint8_t *__restrict result
+) {
+  // every predicate is computed and the one of the trigger selected with bit operations, the loop has no branches
+  // and the arrays do not overlap, so it is vectorized by the compiler
+  size_t firedCount = 0;
+  for (size_t kI = 0; kI < count; ++kI) {
+    uint8_t isChanged = value[kI] != previous[kI];
+    uint8_t isCrossed = (previous[kI] < threshold[kI]) != (value[kI] < threshold[kI]);
+    uint8_t isOutside = abs(value[kI] - reference[kI]) > threshold[kI];
+    uint8_t isDeadband = trigger[kI] == SIMCONNECT_VARIABLE_TRIGGER_DEADBAND;
+    uint8_t isFired = initialized[kI] & (
+        ((trigger[kI] == SIMCONNECT_VARIABLE_TRIGGER_CHANGED) & isChanged)
+            | ((trigger[kI] == SIMCONNECT_VARIABLE_TRIGGER_CROSSED) & isCrossed)
+            | (isDeadband & isOutside)
+    );
+
+    // the deadband moves with every fired value
+    uint8_t isReference = (initialized[kI] ^ 1) | (isFired & isDeadband);
+    reference[kI] = isReference ? value[kI] : reference[kI];
+    previous[kI] = value[kI];
+    initialized[kI] = 1;
+    result[kI] = isFired;
+    firedCount += isFired;
+  }
+  return firedCount;
+}
+
+bool SimConnectDataObserver::isFired(
+    size_t trigger
+) const {
+  return fired[trigger] != 0;
+}
+
+double SimConnectDataObserver::getValue(
+    size_t trigger
+) const {
+  return values[trigger];
+}
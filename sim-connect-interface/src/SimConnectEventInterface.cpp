@@ -0,0 +1,249 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include "SimConnectEventInterface.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+SimConnectEventInterface::SimConnectEventInterface(
+    pmr::memory_resource *resource
+) : states(resource), pendingEvents(resource) {
+}
+
+bool SimConnectEventInterface::connect(
+    int configurationIndex,
+    const string &name,
+    const vector<SimConnectVariable> &events,
+    const DWORD priority
+) {
+  // store connection name
+  connectionName = name;
+
+  // check events before connecting
+  states.assign(events.size(), EventState());
+  for (size_t index = 0; index < events.size(); ++index) {
+    states[index].mode = getMode(events[index]);
+    if (states[index].mode == SIMCONNECT_EVENT_MODE_INVALID) {
+      return false;
+    }
+  }
+  pendingEvents.clear();
+  pendingEvents.reserve(events.size());
+  groupPriority = priority;
+
+  // connect
+  HRESULT result = SimConnect_Open(
+      &hSimConnect,
+      connectionName.c_str(),
+      nullptr,
+      0,
+      nullptr,
+      configurationIndex
+  );
+
+  if (S_OK == result) {
+    // we are now connected
+    isConnected = true;
+    // map events once, the client event id is the index of the event
+    for (size_t index = 0; index < events.size(); ++index) {
+      result = SimConnect_MapClientEventToSimEvent(
+          hSimConnect,
+          static_cast<SIMCONNECT_CLIENT_EVENT_ID>(index),
+          events[index].name.c_str()
+      );
+      if (result != S_OK) {
+        // failed to map event -> disconnect
+        disconnect();
+        // failed to connect
+        return false;
+      }
+    }
+    // success
+    return true;
+  }
+  // fallback -> failed
+  return false;
+}
+
+void SimConnectEventInterface::disconnect() {
+  if (isConnected) {
+    // close connection
+    SimConnect_Close(hSimConnect);
+    // set flag
+    isConnected = false;
+    // reset state
+    states.clear();
+    pendingEvents.clear();
+    // reset handle
+    hSimConnect = nullptr;
+  }
+}
+
+void SimConnectEventInterface::set(
+    size_t index,
+    double value
+) {
+  // nothing is queued without a connection, e.g. after SimConnect was closed
+  if (!isConnected) {
+    return;
+  }
+  if (index >= states.size()) {
+    throw std::out_of_range("Index is out of range!");
+  }
+  auto &state = states[index];
+
+  // triggers are only sent on a rising edge, values only when they changed
+  bool shouldSend;
+  if (state.mode == SIMCONNECT_EVENT_MODE_TRIGGER) {
+    shouldSend = value != 0 && state.input == 0;
+  } else {
+    DWORD eventData = getEventData(state.mode, value);
+    shouldSend = !state.hasSentValue || eventData != state.sentValue;
+    // repeated values within a step are coalesced to the latest one
+    state.value = eventData;
+  }
+  state.input = value;
+
+  // queue event once per step
+  if (shouldSend && !state.isPending) {
+    state.isPending = true;
+    pendingEvents.push_back(index);
+  }
+}
+
+bool SimConnectEventInterface::readData() {
+  // check if we are connected
+  if (!isConnected) {
+    return false;
+  }
+
+  // get next dispatch message(s) and process them
+  DWORD cbData;
+  SIMCONNECT_RECV *pData;
+  while (SUCCEEDED(SimConnect_GetNextDispatch(hSimConnect, &pData, &cbData))) {
+    simConnectProcessDispatchMessage(pData, &cbData);
+  }
+
+  // success
+  return true;
+}
+
+bool SimConnectEventInterface::sendData() {
+  // check if we are connected
+  if (!isConnected) {
+    return false;
+  }
+
+  // transmit queued events
+  bool success = true;
+  for (auto index : pendingEvents) {
+    auto &state = states[index];
+    state.isPending = false;
+
+    // values that changed back to the one transmitted last within a step are not sent again
+    bool isTrigger = state.mode == SIMCONNECT_EVENT_MODE_TRIGGER;
+    if (!isTrigger && state.hasSentValue && state.value == state.sentValue) {
+      continue;
+    }
+
+    HRESULT result = SimConnect_TransmitClientEvent(
+        hSimConnect,
+        SIMCONNECT_OBJECT_ID_USER,
+        static_cast<SIMCONNECT_CLIENT_EVENT_ID>(index),
+        isTrigger ? 0 : state.value,
+        groupPriority,
+        SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY
+    );
+    if (result != S_OK) {
+      // failed -> the value is sent again with the next change
+      success = false;
+      continue;
+    }
+    state.sentValue = state.value;
+    state.hasSentValue = true;
+    transmitCount++;
+  }
+  pendingEvents.clear();
+
+  // return result
+  return success;
+}
+
+unsigned long long SimConnectEventInterface::getTransmitCount() const {
+  return transmitCount;
+}
+
+SIMCONNECT_EVENT_MODE SimConnectEventInterface::getMode(
+    const SimConnectVariable &event
+) {
+  if (event.unit == "TRIGGER") {
+    return SIMCONNECT_EVENT_MODE_TRIGGER;
+  } else if (event.unit == "VALUE") {
+    return SIMCONNECT_EVENT_MODE_VALUE;
+  } else if (event.unit == "AXIS") {
+    return SIMCONNECT_EVENT_MODE_AXIS;
+  }
+  return SIMCONNECT_EVENT_MODE_INVALID;
+}
+
+void SimConnectEventInterface::simConnectProcessDispatchMessage(
+    SIMCONNECT_RECV *pData,
+    DWORD *cbData
+) {
+  switch (pData->dwID) {
+    case SIMCONNECT_RECV_ID_OPEN:
+      // connection established
+      cout << "SimConnect connection established ('" << connectionName << "')" << endl;
+      break;
+
+    case SIMCONNECT_RECV_ID_QUIT:
+      // connection lost
+      cout << "Closed SimConnect connection ('" << connectionName << "')" << endl;
+      disconnect();
+      break;
+
+    case SIMCONNECT_RECV_ID_EXCEPTION:
+      // exception
+      cout << "Exception in SimConnect connection ('" << connectionName << "'): ";
+      cout << ((SIMCONNECT_RECV_EXCEPTION *) pData)->dwException << endl;
+      break;
+
+    default:
+      break;
+  }
+}
+
+DWORD SimConnectEventInterface::getEventData(
+    SIMCONNECT_EVENT_MODE mode,
+    double value
+) {
+  switch (mode) {
+    case SIMCONNECT_EVENT_MODE_AXIS:
+      // the range [-1.0, 1.0] is converted to [-16384, +16384]
+      return static_cast<DWORD>(lround(max(-1.0, min(1.0, value)) * 16384.0));
+
+    case SIMCONNECT_EVENT_MODE_VALUE:
+      return static_cast<DWORD>(lround(value));
+
+    default:
+      return 0;
+  }
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <vector>
+#include "SimConnectLockstep.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+bool SimConnectLockstep::connect(
+    int configurationIndex,
+    const string &name,
+    const shared_ptr<SimConnectDataInterface> &dataInterface,
+    chrono::milliseconds timeout
+) {
+  // the data interface provides the state and the frame events
+  if (!dataInterface) {
+    return false;
+  }
+  data = dataInterface;
+  frameTimeout = timeout;
+
+  // frames while running are all frames without the ones while paused
+  if (!data->subscribeToSystemState()
+      || !data->subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_FRAME)
+      || !data->subscribeToSystemEvent(SIMCONNECT_SYSTEM_EVENT_PAUSE_FRAME)) {
+    return false;
+  }
+
+  // the sim is paused and resumed by key events, the order matches LOCKSTEP_EVENT
+  vector<SimConnectVariable> pauseEvents;
+  pauseEvents.emplace_back("PAUSE_ON", "TRIGGER");
+  pauseEvents.emplace_back("PAUSE_OFF", "TRIGGER");
+  return events.connect(
+      configurationIndex,
+      name,
+      pauseEvents
+  );
+}
+
+void SimConnectLockstep::disconnect() {
+  // never leave the sim paused behind
+  if (isRunning) {
+    stop();
+  }
+  events.disconnect();
+  data.reset();
+}
+
+bool SimConnectLockstep::start() {
+  // pause the sim, from now on it only advances in steps
+  if (!transmit(LOCKSTEP_EVENT_PAUSE_ON)) {
+    return false;
+  }
+  // a sim paused before connecting sends no pause event, it is then detected by its pause frames
+  if (!waitForPause(true)) {
+    return false;
+  }
+  isRunning = true;
+  stepCount = 0;
+  frameCount = 0;
+  startTime = chrono::steady_clock::now();
+
+  // success
+  return true;
+}
+
+bool SimConnectLockstep::advance() {
+  // check if lockstep is running
+  if (!isRunning) {
+    return false;
+  }
+
+  // resume the sim until at least one frame was simulated
+  auto runningFrames = getRunningFrames();
+  if (!transmit(LOCKSTEP_EVENT_PAUSE_OFF)) {
+    return false;
+  }
+  auto timeout = chrono::steady_clock::now() + frameTimeout;
+  while (getRunningFrames() == runningFrames) {
+    if (!waitForMessage(timeout)) {
+      return false;
+    }
+  }
+
+  // pause again before the next step is computed
+  if (!transmit(LOCKSTEP_EVENT_PAUSE_ON) || !waitForPause(true)) {
+    return false;
+  }
+  stepCount++;
+  frameCount += getRunningFrames() - runningFrames;
+
+  // success
+  return true;
+}
+
+bool SimConnectLockstep::stop() {
+  // resume the sim in real time
+  isRunning = false;
+  return transmit(LOCKSTEP_EVENT_PAUSE_OFF) && waitForPause(false);
+}
+
+unsigned long long SimConnectLockstep::getStepCount() const {
+  return stepCount;
+}
+
+unsigned long long SimConnectLockstep::getFrameCount() const {
+  return frameCount;
+}
+
+double SimConnectLockstep::getFramesPerSecond() const {
+  auto duration = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+  if (duration <= 0) {
+    return 0;
+  }
+  return static_cast<double>(frameCount) / duration;
+}
+
+bool SimConnectLockstep::transmit(
+    LOCKSTEP_EVENT event
+) {
+  // triggers are sent on a rising edge -> rearm afterwards
+  events.set(event, 1.0);
+  bool success = events.sendData();
+  events.set(event, 0.0);
+  events.readData();
+
+  // return result
+  return success;
+}
+
+bool SimConnectLockstep::waitForPause(
+    bool paused
+) {
+  // wait until the sim reports the requested pause state, a pause frame without running frames proves a pause
+  auto timeout = chrono::steady_clock::now() + frameTimeout;
+  while (data->getSystemState().isPaused != paused) {
+    auto runningFrames = getRunningFrames();
+    auto pauseFrames = data->getSystemEventCount(SIMCONNECT_SYSTEM_EVENT_PAUSE_FRAME);
+    if (!waitForMessage(timeout)) {
+      return false;
+    }
+    if (paused
+        && getRunningFrames() == runningFrames
+        && data->getSystemEventCount(SIMCONNECT_SYSTEM_EVENT_PAUSE_FRAME) > pauseFrames) {
+      break;
+    }
+  }
+
+  // success
+  return true;
+}
+
+bool SimConnectLockstep::waitForMessage(
+    chrono::steady_clock::time_point timeout
+) {
+  // sleep until SimConnect signals a message instead of polling
+  auto remaining = chrono::duration_cast<chrono::milliseconds>(timeout - chrono::steady_clock::now());
+  if (remaining.count() <= 0) {
+    return false;
+  }
+  DWORD result = WaitForSingleObject(data->getDispatchEvent(), static_cast<DWORD>(remaining.count()));
+  if (result != WAIT_OBJECT_0) {
+    return false;
+  }
+  return data->readData();
+}
+
+unsigned long long SimConnectLockstep::getRunningFrames() const {
+  return data->getSystemEventCount(SIMCONNECT_SYSTEM_EVENT_FRAME)
+      - data->getSystemEventCount(SIMCONNECT_SYSTEM_EVENT_PAUSE_FRAME);
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <new>
+#include "SimConnectMemoryGuard.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+// set while an allocation of the default resource is forwarded, it is recorded there already
+static thread_local bool isForwarding = false;
+
+SimConnectMemoryGuard::SimConnectMemoryGuard(
+    bool isStrict
+) : isStrict(isStrict), previous(pmr::set_default_resource(this)), previousActive(active.exchange(this)) {
+}
+
+SimConnectMemoryGuard::~SimConnectMemoryGuard() {
+  // restore the resource and the guard that were active before
+  active = previousActive;
+  pmr::set_default_resource(previous);
+}
+
+void SimConnectMemoryGuard::recordGlobalAllocation(
+    size_t bytes
+) {
+  // allocations outside of a guard or forwarded by the guard itself are not recorded
+  auto *guard = active.load();
+  if (!guard || isForwarding) {
+    return;
+  }
+  guard->allocationCount++;
+  guard->allocatedSize += bytes;
+
+  // in strict mode the allocation fails
+  if (guard->isStrict) {
+    throw bad_alloc();
+  }
+}
+
+unsigned long long SimConnectMemoryGuard::getAllocationCount() const {
+  return allocationCount;
+}
+
+size_t SimConnectMemoryGuard::getAllocatedSize() const {
+  return allocatedSize;
+}
+
+bool SimConnectMemoryGuard::isUntouched() const {
+  return allocationCount == 0;
+}
+
+void *SimConnectMemoryGuard::do_allocate(
+    size_t bytes,
+    size_t alignment
+) {
+  // every use of the default resource while guarded is recorded
+  allocationCount++;
+  allocatedSize += bytes;
+
+  // in strict mode the allocation fails
+  if (isStrict) {
+    throw bad_alloc();
+  }
+  // the previous resource may use the global operator new, which must not record the allocation again
+  isForwarding = true;
+  try {
+    void *p = previous->allocate(bytes, alignment);
+    isForwarding = false;
+    return p;
+  } catch (...) {
+    isForwarding = false;
+    throw;
+  }
+}
+
+void SimConnectMemoryGuard::do_deallocate(
+    void *p,
+    size_t bytes,
+    size_t alignment
+) {
+  previous->deallocate(p, bytes, alignment);
+}
+
+bool SimConnectMemoryGuard::do_is_equal(
+    const pmr::memory_resource &other
+) const noexcept {
+  return this == &other;
+}
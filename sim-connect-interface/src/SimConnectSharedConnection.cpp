@@ -0,0 +1,186 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "SimConnectSharedConnection.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+SimConnectSharedConnection::SimConnectSharedConnection(
+    string connectionName
+) : connectionName(std::move(connectionName)), dataInterface(make_shared<SimConnectDataInterface>()) {
+}
+
+SimConnectSharedConnection::~SimConnectSharedConnection() {
+  // the last block using the connection closes it
+  dataInterface->disconnect();
+}
+
+shared_ptr<SimConnectSharedConnection> SimConnectSharedConnection::get(
+    const string &connectionName,
+    SIMCONNECT_VARIABLE_PRIORITY priority
+) {
+  lock_guard<std::mutex> lock(registryMutex);
+
+  // blocks bound to the same connection and priority share one connection
+  auto &entry = registry[{connectionName, priority}];
+  auto connection = entry.lock();
+  if (!connection) {
+    connection = make_shared<SimConnectSharedConnection>(connectionName);
+    entry = connection;
+  }
+
+  // return result
+  return connection;
+}
+
+size_t SimConnectSharedConnection::add(
+    const SimConnectVariable &variable
+) {
+  lock_guard<std::mutex> lock(mutex);
+
+  // appended, so the indices of the variables of other blocks stay valid
+  dataDefinition.add(variable);
+  isChanged = true;
+  return dataDefinition.getLogicalSize() - 1;
+}
+
+size_t SimConnectSharedConnection::addStatic(
+    const SimConnectVariable &variable
+) {
+  lock_guard<std::mutex> lock(mutex);
+
+  // appended, so the indices of the variables of other blocks stay valid
+  staticDataDefinition.add(variable);
+  isStaticChanged = true;
+  return staticDataDefinition.getLogicalSize() - 1;
+}
+
+bool SimConnectSharedConnection::connect(
+    int configurationIndex,
+    const string &name
+) {
+  lock_guard<std::mutex> lock(mutex);
+
+  // all buffers of the connection are placed behind each other in one arena
+  auto arena = SimConnectDataArena::get(connectionName);
+
+  // the first block opens the connection, variables added by later blocks replace the data object
+  if (!dataInterface->isOpen()) {
+    data = make_shared<SimConnectData>(dataDefinition, arena);
+    if (!dataInterface->connect(configurationIndex, name, dataDefinition, data)) {
+      return false;
+    }
+  } else if (isChanged) {
+    auto nextData = make_shared<SimConnectData>(dataDefinition, arena);
+    if (!dataInterface->reconfigure(dataDefinition, nextData)) {
+      return false;
+    }
+    data = nextData;
+  }
+  isChanged = false;
+
+  // static variables are served from cache and only read again on load events
+  if (isStaticChanged || !staticData) {
+    auto nextStaticData = make_shared<SimConnectData>(staticDataDefinition, arena);
+    if (staticData) {
+      nextStaticData->carryOver(*staticData);
+    }
+    if (staticDataDefinition.size() > 0 && !dataInterface->setStaticData(staticDataDefinition, nextStaticData)) {
+      return false;
+    }
+    staticData = nextStaticData;
+  }
+  isStaticChanged = false;
+
+  // adaptive variables of any block let the connection request them less often while they change slowly
+  for (size_t index = 0; index < dataDefinition.size() && !updateRateScheduler; ++index) {
+    if (dataDefinition.get(index).isAdaptive) {
+      updateRateScheduler = make_shared<SimConnectUpdateRateScheduler>(SimConnectUpdateRateScheduler::Configuration());
+      dataInterface->setUpdateRateScheduler(updateRateScheduler);
+    }
+  }
+
+  // success
+  return true;
+}
+
+size_t SimConnectSharedConnection::join() {
+  lock_guard<std::mutex> lock(mutex);
+
+  // participant takes part starting with the next step
+  Participant participant;
+  participant.isActive = true;
+  participant.step = step;
+  participants.push_back(participant);
+
+  // return result
+  return participants.size() - 1;
+}
+
+void SimConnectSharedConnection::leave(
+    size_t participant
+) {
+  lock_guard<std::mutex> lock(mutex);
+  if (participant < participants.size()) {
+    participants[participant].isActive = false;
+  }
+}
+
+bool SimConnectSharedConnection::update(
+    size_t participant
+) {
+  lock_guard<std::mutex> lock(mutex);
+  if (participant >= participants.size() || !participants[participant].isActive) {
+    return false;
+  }
+
+  // the others of the step use the frame read by the first one
+  if (participants[participant].step != step) {
+    participants[participant].step = step;
+    return true;
+  }
+
+  // a participant arriving twice starts the next step, its frame is requested and read once for all blocks
+  step++;
+  participants[participant].step = step;
+  return dataInterface->requestData() && dataInterface->readData();
+}
+
+const SimConnectDataDefinition &SimConnectSharedConnection::getDataDefinition() const {
+  return dataDefinition;
+}
+
+const shared_ptr<SimConnectData> &SimConnectSharedConnection::getData() const {
+  return data;
+}
+
+const SimConnectDataDefinition &SimConnectSharedConnection::getStaticDataDefinition() const {
+  return staticDataDefinition;
+}
+
+const shared_ptr<SimConnectData> &SimConnectSharedConnection::getStaticData() const {
+  return staticData;
+}
+
+const shared_ptr<SimConnectDataInterface> &SimConnectSharedConnection::getDataInterface() const {
+  return dataInterface;
+}
+
+unsigned long long SimConnectSharedConnection::getStep() const {
+  lock_guard<std::mutex> lock(mutex);
+  return step;
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <mutex>
+#include <stdexcept>
+#include "SimConnectString.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+SimConnectStringPool::SimConnectStringPool() {
+  // the empty string always has id 0
+  strings.emplace_back();
+  index.emplace(strings.back(), 0);
+}
+
+SimConnectStringPool &SimConnectStringPool::getInstance() {
+  static SimConnectStringPool instance;
+  return instance;
+}
+
+uint32_t SimConnectStringPool::intern(
+    string_view value,
+    const string **pValue
+) {
+  auto &pool = getInstance();
+
+  // most strings are already known
+  {
+    shared_lock<shared_mutex> lock(pool.mutex);
+    auto it = pool.index.find(value);
+    if (it != pool.index.end()) {
+      if (pValue) {
+        *pValue = &pool.strings[it->second];
+      }
+      return it->second;
+    }
+  }
+
+  // append new string, elements of a deque keep their address when appending
+  unique_lock<shared_mutex> lock(pool.mutex);
+  auto it = pool.index.find(value);
+  if (it == pool.index.end()) {
+    if (pool.strings.size() > UINT32_MAX) {
+      throw overflow_error("String pool is full!");
+    }
+    auto id = static_cast<uint32_t>(pool.strings.size());
+    pool.strings.emplace_back(value);
+    it = pool.index.emplace(pool.strings.back(), id).first;
+  }
+  if (pValue) {
+    *pValue = &pool.strings[it->second];
+  }
+  return it->second;
+}
+
+const string &SimConnectStringPool::get(
+    uint32_t id
+) {
+  auto &pool = getInstance();
+  shared_lock<shared_mutex> lock(pool.mutex);
+  return pool.strings.at(id);
+}
+
+size_t SimConnectStringPool::size() {
+  auto &pool = getInstance();
+  shared_lock<shared_mutex> lock(pool.mutex);
+  return pool.strings.size();
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "SimConnectUnitConverter.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+size_t SimConnectUnitConverter::add(
+    size_t sourceIndex,
+    SimConnectUnitConversion conversion
+) {
+  // the index of the converted value in the target
+  sourceIndices.push_back(sourceIndex);
+  scales.push_back(conversion.scale);
+  offsets.push_back(conversion.offset);
+  return sourceIndices.size() - 1;
+}
+
+void SimConnectUnitConverter::clear() {
+  sourceIndices.clear();
+  scales.clear();
+  offsets.clear();
+}
+
+size_t SimConnectUnitConverter::size() const {
+  return sourceIndices.size();
+}
+
+void SimConnectUnitConverter::convert(
+    const double *source,
+    double *target
+) const {
+  const size_t count = sourceIndices.size();
+  const size_t *indices = sourceIndices.data();
+  const double *scale = scales.data();
+  const double *offset = offsets.data();
+
+  // gather first, the affine loop has no indirection and is vectorized by the compiler
+  for (size_t kI = 0; kI < count; ++kI) {
+    target[kI] = source[indices[kI]];
+  }
+  for (size_t kI = 0; kI < count; ++kI) {
+    target[kI] = target[kI] * scale[kI] + offset[kI];
+  }
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "SimConnectUpdateRateScheduler.h"
+
+using namespace std;
+using namespace simconnect::toolbox::connection;
+
+SimConnectUpdateRateScheduler::SimConnectUpdateRateScheduler(
+    const Configuration &configuration
+) : configuration(configuration) {
+}
+
+void SimConnectUpdateRateScheduler::reset(
+    size_t count
+) {
+  states.assign(count, VariableState());
+  intervals.assign(count, 1);
+  frameCount = 0;
+}
+
+bool SimConnectUpdateRateScheduler::update(
+    SimConnectDataDefinition &dataDefinition,
+    SimConnectData &data
+) {
+  // ensure state matches definition
+  if (states.size() != dataDefinition.size()) {
+    reset(dataDefinition.size());
+  }
+
+  // observe rate of change of every variable
+  for (size_t index = 0; index < states.size(); ++index) {
+    auto type = dataDefinition.getType(index);
+    observe(states[index], getValue(type, data.get(index)), intervals[index]);
+  }
+
+  // partition only periodically
+  if (++frameCount % max<size_t>(1, configuration.partitionPeriod) != 0) {
+    return false;
+  }
+
+  // move adaptive variables between fast and slow group, all others are requested every step
+  bool hasChanged = false;
+  for (size_t index = 0; index < states.size(); ++index) {
+    const auto &variable = dataDefinition.get(index);
+    size_t interval = 1;
+    if (variable.isAdaptive) {
+      double errorBound = variable.adaptiveErrorBound > 0
+          ? variable.adaptiveErrorBound
+          : configuration.relativeErrorBound * states[index].magnitude;
+      interval = getInterval(states[index], intervals[index], errorBound);
+    }
+    if (interval != intervals[index]) {
+      intervals[index] = interval;
+      hasChanged = true;
+    }
+  }
+
+  // return result
+  return hasChanged;
+}
+
+const vector<size_t> &SimConnectUpdateRateScheduler::getIntervals() const {
+  return intervals;
+}
+
+void SimConnectUpdateRateScheduler::observe(
+    VariableState &state,
+    const array<double, 3> &value,
+    size_t interval
+) const {
+  // largest magnitude seen for relative error bounds
+  for (auto element : value) {
+    state.magnitude = max(state.magnitude, abs(element));
+  }
+
+  // first value -> nothing to compare with
+  state.framesSinceValue++;
+  if (!state.hasValue) {
+    state.value = value;
+    state.hasValue = true;
+    state.framesSinceValue = 0;
+    return;
+  }
+
+  // slow variables only get a new value every interval
+  if (state.framesSinceValue < interval) {
+    return;
+  }
+
+  // change per frame since last observation
+  double change = 0;
+  for (size_t kI = 0; kI < value.size(); ++kI) {
+    change = max(change, abs(value[kI] - state.value[kI]));
+  }
+  change /= static_cast<double>(state.framesSinceValue);
+
+  // smoothed rate and deviation from it
+  double deviation = abs(change - state.rate);
+  state.rate += configuration.smoothing * (change - state.rate);
+  state.noise += configuration.smoothing * (deviation - state.noise);
+
+  // store value
+  state.value = value;
+  state.framesSinceValue = 0;
+}
+
+size_t SimConnectUpdateRateScheduler::getInterval(
+    const VariableState &state,
+    size_t interval,
+    double errorBound
+) const {
+  // expected change of the variable within the slow interval
+  double expectedChange = (state.rate + state.noise) * static_cast<double>(configuration.slowInterval);
+
+  // hysteresis avoids moving variables back and forth, constant variables are always slow
+  if (expectedChange > errorBound) {
+    return 1;
+  }
+  if (expectedChange <= 0.5 * errorBound) {
+    return max<size_t>(1, configuration.slowInterval);
+  }
+  return interval;
+}
+
+array<double, 3> SimConnectUpdateRateScheduler::getValue(
+    SIMCONNECT_VARIABLE_TYPE type,
+    const any &value
+) {
+  switch (type) {
+    case SIMCONNECT_VARIABLE_TYPE_BOOL:
+      return {any_cast<bool>(value) ? 1.0 : 0.0, 0, 0};
+    case SIMCONNECT_VARIABLE_TYPE_INT32:
+      return {static_cast<double>(any_cast<long>(value)), 0, 0};
+    case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
+      return {static_cast<double>(any_cast<float>(value)), 0, 0};
+    case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
+      return {any_cast<double>(value), 0, 0};
+    case SIMCONNECT_VARIABLE_TYPE_LATLONALT: {
+      auto latLonAlt = any_cast<SIMCONNECT_DATA_LATLONALT>(value);
+      return {latLonAlt.Latitude, latLonAlt.Longitude, latLonAlt.Altitude};
+    }
+    case SIMCONNECT_VARIABLE_TYPE_XYZ: {
+      auto xyz = any_cast<SIMCONNECT_DATA_XYZ>(value);
+      return {xyz.x, xyz.y, xyz.z};
+    }
+    case SIMCONNECT_VARIABLE_TYPE_STRING8:
+    case SIMCONNECT_VARIABLE_TYPE_STRING32:
+    case SIMCONNECT_VARIABLE_TYPE_STRING64:
+    case SIMCONNECT_VARIABLE_TYPE_STRING256:
+      // strings have no rate of change and rarely change at all
+      return {};
+    default:
+      return {};
+  }
+}
@@ -14,8 +14,13 @@
  *     limitations under the License.
  */
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
 #include <iostream>
+#include <mutex>
 #include <regex>
+#include <vector>
 #include "SimConnectVariableLookupTable.h"
 
 using namespace std;
@@ -24,18 +29,26 @@ using namespace simconnect::toolbox::connection;
 bool SimConnectVariableLookupTable::isKnown(
     const SimConnectVariable &item
 ) {
-  return LOOKUP_TABLE.find(normalizeName(item.name)) != LOOKUP_TABLE.end();
+  return resolve(item).isKnown;
 }
 
 SIMCONNECT_VARIABLE_TYPE SimConnectVariableLookupTable::getDataType(
     const SimConnectVariable &item
 ) {
   // check if variable is known
-  if (!isKnown(item)) {
+  auto entry = resolve(item);
+  if (!entry.isKnown) {
     throw invalid_argument("The variable is not known!");
   }
   // return data type that is mapped to variable
-  return LOOKUP_TABLE.at(normalizeName(item.name));
+  return entry.type;
+}
+
+bool SimConnectVariableLookupTable::isStatic(
+    const SimConnectVariable &item
+) {
+  // flagged by the user or known to be constant during a flight
+  return item.isStatic || resolve(item).isStatic;
 }
 
 string SimConnectVariableLookupTable::normalizeName(
@@ -44,3 +57,211 @@ string SimConnectVariableLookupTable::normalizeName(
   // this is needed to support indexed variables
   return regex_replace(itemName, regex("(.*)(:[0-9]+)"), "$1:index");
 }
+
+void SimConnectVariableLookupTable::registerVariable(
+    const string &name,
+    SIMCONNECT_VARIABLE_TYPE type,
+    bool isStatic
+) {
+  // check type
+  if (type == SIMCONNECT_VARIABLE_TYPE_INVALID) {
+    throw invalid_argument("Variable type not valid!");
+  }
+
+  // add entry, names resolved before are resolved again
+  unique_lock<shared_mutex> lock(registryMutex);
+  registered[toRegistryName(name)] = {true, isStatic, type};
+  resolved.clear();
+}
+
+bool SimConnectVariableLookupTable::loadRegistryFile(
+    const string &path
+) {
+  // open file
+  HANDLE file = CreateFileA(
+      path.c_str(),
+      GENERIC_READ,
+      FILE_SHARE_READ,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr
+  );
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    return false;
+  }
+  if (size.QuadPart == 0) {
+    CloseHandle(file);
+    return true;
+  }
+
+  // map file into memory, the registry is parsed without copying the file
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr) {
+    CloseHandle(file);
+    return false;
+  }
+  const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  // parse entries
+  unordered_map<string, Entry> entries;
+  try {
+    parseRegistry(string_view(static_cast<const char *>(view), static_cast<size_t>(size.QuadPart)), entries);
+  } catch (...) {
+    UnmapViewOfFile(view);
+    CloseHandle(mapping);
+    CloseHandle(file);
+    throw;
+  }
+  UnmapViewOfFile(view);
+  CloseHandle(mapping);
+  CloseHandle(file);
+
+  // add all entries at once, names resolved before are resolved again
+  unique_lock<shared_mutex> lock(registryMutex);
+  for (auto &[name, entry] : entries) {
+    registered[name] = entry;
+  }
+  resolved.clear();
+  return true;
+}
+
+void SimConnectVariableLookupTable::loadRegistryFileFromEnvironment() {
+  // the user registry is loaded on first use when configured
+  const char *path = getenv(REGISTRY_FILE_ENVIRONMENT_VARIABLE.c_str());
+  if (path == nullptr || *path == '\0') {
+    return;
+  }
+  try {
+    if (!loadRegistryFile(path)) {
+      cerr << "Failed to load variable registry '" << path << "'" << endl;
+    }
+  } catch (exception &ex) {
+    cerr << "Failed to load variable registry '" << path << "': " << ex.what() << endl;
+  }
+}
+
+void SimConnectVariableLookupTable::parseRegistry(
+    string_view content,
+    unordered_map<string, Entry> &entries
+) {
+  // trims a field and converts it to upper case
+  auto toField = [](string_view value) {
+    while (!value.empty() && isspace(static_cast<unsigned char>(value.front()))) {
+      value.remove_prefix(1);
+    }
+    while (!value.empty() && isspace(static_cast<unsigned char>(value.back()))) {
+      value.remove_suffix(1);
+    }
+    return toRegistryName(string(value));
+  };
+
+  // one entry per line: NAME, TYPE[, STATIC], lines starting with # are comments
+  while (!content.empty()) {
+    size_t kEnd = content.find('\n');
+    string_view line = content.substr(0, kEnd);
+    content.remove_prefix(kEnd == string_view::npos ? content.size() : kEnd + 1);
+
+    // split line into fields
+    vector<string> fields;
+    size_t kPosition;
+    while ((kPosition = line.find(',')) != string_view::npos) {
+      fields.push_back(toField(line.substr(0, kPosition)));
+      line.remove_prefix(kPosition + 1);
+    }
+    fields.push_back(toField(line));
+    if (fields.size() == 1 && (fields[0].empty() || fields[0].front() == '#')) {
+      continue;
+    }
+
+    // get entry
+    Entry entry;
+    entry.isKnown = true;
+    entry.type = fields.size() >= 2 ? SimConnectVariableType::fromName(fields[1]) : SIMCONNECT_VARIABLE_TYPE_INVALID;
+    entry.isStatic = fields.size() == 3 && fields[2] == "STATIC";
+    if (fields[0].empty() || entry.type == SIMCONNECT_VARIABLE_TYPE_INVALID || fields.size() > 3
+        || (fields.size() == 3 && !entry.isStatic)) {
+      throw invalid_argument("Variable registry entry not valid!");
+    }
+    entries[fields[0]] = entry;
+  }
+}
+
+string SimConnectVariableLookupTable::toRegistryName(
+    string name
+) {
+  // names are upper case, indexed variables are registered as NAME:index
+  transform(name.begin(), name.end(), name.begin(), ::toupper);
+  if (name.size() > INDEX_SUFFIX.size()
+      && name.compare(name.size() - INDEX_SUFFIX.size(), INDEX_SUFFIX.size(), ":INDEX") == 0) {
+    name.replace(name.size() - INDEX_SUFFIX.size(), INDEX_SUFFIX.size(), INDEX_SUFFIX);
+  }
+  return name;
+}
+
+SimConnectVariableLookupTable::Entry SimConnectVariableLookupTable::resolve(
+    const SimConnectVariable &item
+) {
+  // an explicit type takes precedence over the registry
+  Entry entry = resolveName(item.name);
+  if (item.type != SIMCONNECT_VARIABLE_TYPE_INVALID) {
+    entry.isKnown = true;
+    entry.type = item.type;
+  }
+  return entry;
+}
+
+SimConnectVariableLookupTable::Entry SimConnectVariableLookupTable::resolveName(
+    const SimConnectString &name
+) {
+  // load user registry on first use
+  call_once(registryLoaded, loadRegistryFileFromEnvironment);
+
+  // names are resolved once per interned id
+  {
+    shared_lock<shared_mutex> lock(registryMutex);
+    auto it = resolved.find(name.getId());
+    if (it != resolved.end()) {
+      return it->second;
+    }
+  }
+  unique_lock<shared_mutex> lock(registryMutex);
+  auto it = resolved.find(name.getId());
+  if (it != resolved.end()) {
+    return it->second;
+  }
+
+  // resolve name, the user registry takes precedence over the built-in table
+  Entry entry;
+  auto normalizedName = normalizeName(name);
+  auto itRegistered = registered.find(name);
+  if (itRegistered == registered.end()) {
+    itRegistered = registered.find(normalizedName);
+  }
+  auto itBuiltIn = LOOKUP_TABLE.find(normalizedName);
+  if (itRegistered != registered.end()) {
+    entry = itRegistered->second;
+  } else if (itBuiltIn != LOOKUP_TABLE.end()) {
+    entry.isKnown = true;
+    entry.type = itBuiltIn->second;
+    entry.isStatic = STATIC_LOOKUP_TABLE.find(normalizedName) != STATIC_LOOKUP_TABLE.end();
+  } else if (name.str().compare(0, LOCAL_VARIABLE_PREFIX.size(), LOCAL_VARIABLE_PREFIX) == 0) {
+    // local variables are always 64-bit floating point numbers
+    entry.isKnown = true;
+    entry.type = SIMCONNECT_VARIABLE_TYPE_FLOAT64;
+  }
+
+  // store result
+  resolved.emplace(name.getId(), entry);
+  return entry;
+}
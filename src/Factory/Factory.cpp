@@ -1,3 +1,4 @@
+#include "SimConnectEventSink.h"
 #include "SimConnectInput.h"
 #include "SimConnectSink.h"
 #include "SimConnectSource.h"
@@ -8,6 +9,12 @@
 // Class factory API
 #include <shlibpp/SharedLibraryClassApi.h>
 
+SHLIBPP_DEFINE_SHARED_SUBCLASS(
+    SimConnectEventSink,
+    simconnect::toolbox::blocks::SimConnectEventSink,
+    blockfactory::core::Block
+);
+
 SHLIBPP_DEFINE_SHARED_SUBCLASS(
     SimConnectInput,
     simconnect::toolbox::blocks::SimConnectInput,
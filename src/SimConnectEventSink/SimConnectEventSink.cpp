@@ -0,0 +1,214 @@
+/*
+ * Copyright 2020 Andreas Guther
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "SimConnectEventSink.h"
+
+#include <BlockFactory/Core/Log.h>
+#include <BlockFactory/Core/Parameter.h>
+#include <BlockFactory/Core/Signal.h>
+#include <SimConnectVariableParser.h>
+
+using namespace blockfactory::core;
+using namespace simconnect::toolbox::blocks;
+using namespace simconnect::toolbox::connection;
+
+unsigned SimConnectEventSink::numberOfParameters() {
+  return Block::numberOfParameters() + 3;
+}
+
+bool SimConnectEventSink::parseParameters(
+    BlockInformation *blockInfo
+) {
+  // get base index
+  unsigned int index = Block::numberOfParameters();
+
+  // define parameters
+  const std::vector<ParameterMetadata> metadata{
+      {ParameterType::INT, index++, 1, 1, "ConfigurationIndex"},
+      {ParameterType::STRING, index++, 1, 1, "ConnectionName"},
+      {ParameterType::STRING, index++, 1, 1, "Variables"}
+  };
+
+  // add parameters
+  for (const auto &md : metadata) {
+    if (!blockInfo->addParameterMetadata(md)) {
+      bfError << "Failed to store parameter metadata";
+      return false;
+    }
+  }
+
+  return blockInfo->parseParameters(m_parameters);
+}
+
+bool SimConnectEventSink::configureSizeAndPorts(
+    BlockInformation *blockInfo
+) {
+  if (!Block::configureSizeAndPorts(blockInfo)) {
+    return false;
+  }
+
+  // parse the parameters
+  if (!SimConnectEventSink::parseParameters(blockInfo)) {
+    bfError << "Failed to parse parameters.";
+    return false;
+  }
+  // store together the port information objects
+  InputPortsInfo inputPortInfo;
+  OutputPortsInfo outputPortInfo;
+
+  // read variables parameter
+  std::string parameterVariables;
+  if (!m_parameters.getParameter("Variables", parameterVariables)) {
+    bfError << "Failed to parse Operation parameter";
+    return false;
+  }
+
+  // get input count
+  try {
+    auto events = SimConnectVariableParser::getSimConnectVariablesFromParameterString(parameterVariables);
+    for (unsigned long long kI = 0; kI < events.size(); ++kI) {
+      if (SimConnectEventInterface::getMode(events[kI]) == SIMCONNECT_EVENT_MODE_INVALID) {
+        bfError << "Event mode not known: " << events[kI].unit;
+        return false;
+      }
+      inputPortInfo.push_back(
+          {
+              kI,
+              {1},
+              Port::DataType::DOUBLE
+          }
+      );
+    }
+  } catch (std::exception &ex) {
+    bfError << "Failed to parse variables: " << ex.what();
+    return false;
+  }
+
+  // store the port information into the BlockInformation
+  if (!blockInfo->setPortsInfo(inputPortInfo, outputPortInfo)) {
+    bfError << "Failed to configure input / output ports";
+    return false;
+  }
+
+  return true;
+}
+
+bool SimConnectEventSink::initialize(
+    BlockInformation *blockInfo
+) {
+  // the base Block class need to be initialized first
+  if (!Block::initialize(blockInfo)) {
+    return false;
+  }
+
+  // parse the parameters
+  if (!SimConnectEventSink::parseParameters(blockInfo)) {
+    bfError << "Failed to parse parameters.";
+    return false;
+  }
+
+  // read the Operation parameter and store it as a private member
+  if (!m_parameters.getParameter("ConfigurationIndex", configurationIndex)) {
+    bfError << "Failed to parse ConfigurationIndex parameter";
+    return false;
+  }
+
+  // read the Operation parameter and store it as a private member
+  if (!m_parameters.getParameter("ConnectionName", connectionName)) {
+    bfError << "Failed to parse ConnectionName parameter";
+    return false;
+  }
+
+  // read variables parameter
+  std::string parameterVariables;
+  if (!m_parameters.getParameter("Variables", parameterVariables)) {
+    bfError << "Failed to parse Variables parameter";
+    return false;
+  }
+  try {
+    // parse events
+    simConnectEvents = SimConnectVariableParser::getSimConnectVariablesFromParameterString(parameterVariables);
+  } catch (std::exception &ex) {
+    bfError << "Failed to parse variables: " << ex.what();
+    return false;
+  }
+
+  // connect to FS, events are mapped once here
+  bool connected = simConnectInterface.connect(
+      configurationIndex,
+      connectionName,
+      simConnectEvents
+  );
+  if (!connected) {
+    bfError << "Failed to connect to SimConnect";
+    return false;
+  }
+
+  return true;
+}
+
+bool SimConnectEventSink::output(
+    const BlockInformation *blockInfo
+) {
+  // vector for input signals
+  std::vector<InputSignalPtr> inputSignals;
+  for (int kI = 0; kI < simConnectEvents.size(); ++kI) {
+    // get input signal
+    auto inputSignal = blockInfo->getInputPortSignal(kI);
+    // check if input is ok
+    if (!inputSignal) {
+      bfError << "Signals not valid";
+      return false;
+    }
+    // store signal
+    inputSignals.emplace_back(inputSignal);
+  }
+
+  // pass input values, only edges and changed values are queued
+  try {
+    for (int kI = 0; kI < inputSignals.size(); ++kI) {
+      simConnectInterface.set(kI, inputSignals[kI]->get<double>(0));
+    }
+  } catch (std::exception &ex) {
+    bfError << "Failed to set event: " << ex.what();
+    return false;
+  }
+
+  // process messages from simconnect
+  if (!simConnectInterface.readData()) {
+    bfError << "Failed to read from SimConnect";
+    return false;
+  }
+
+  // transmit queued events
+  if (!simConnectInterface.sendData()) {
+    bfError << "Failed to transmit events to SimConnect";
+    return false;
+  }
+
+  // return result
+  return true;
+}
+
+bool SimConnectEventSink::terminate(
+    const BlockInformation *blockInfo
+) {
+  // disconnect
+  simConnectInterface.disconnect();
+
+  // success
+  return true;
+}
@@ -16,6 +16,7 @@
 
 #include "SimConnectInput.h"
 
+#include <iostream>
 #include <BlockFactory/Core/Log.h>
 #include <BlockFactory/Core/Parameter.h>
 #include <BlockFactory/Core/Signal.h>
@@ -147,7 +148,10 @@ bool SimConnectInput::initialize(
     simConnectDataDefinition = SimConnectVariableParser::getSimConnectDataDefinitionFromVariables(simConnectVariables);
 
     // create data object
-    simConnectData = std::make_shared<SimConnectData>(simConnectDataDefinition);
+    simConnectData = std::make_shared<SimConnectData>(
+        simConnectDataDefinition,
+        SimConnectDataArena::get(connectionName)
+    );
 
   } catch (std::exception &ex) {
     bfError << "Failed to parse variables: " << ex.what();
@@ -166,6 +170,11 @@ bool SimConnectInput::initialize(
     return false;
   }
 
+  // buffers of all blocks of the connection share one arena, report how many heap allocations back them
+  auto arena = SimConnectDataArena::get(connectionName);
+  std::cout << "SimConnectInput ('" << connectionName << "'): " << arena->getBufferCount() << " buffers in ";
+  std::cout << arena->getAllocationCount() << " arena allocations" << std::endl;
+
   return true;
 }
 
@@ -174,7 +183,7 @@ bool SimConnectInput::output(
 ) {
   // vector for output signals
   std::vector<OutputSignalPtr> outputSignals;
-  for (int kI = 0; kI < simConnectDataDefinition.size(); ++kI) {
+  for (int kI = 0; kI < simConnectDataDefinition.getLogicalSize(); ++kI) {
     // get output signal
     auto outputSignal = blockInfo->getOutputPortSignal(kI);
     // check if output is ok
@@ -192,11 +201,12 @@ bool SimConnectInput::output(
     return false;
   }
 
-  // write output value to all signals
+  // write output value to all signals, duplicates share the physical variable
   for (int kI = 0; kI < outputSignals.size(); ++kI) {
-    switch (simConnectDataDefinition.getType(kI)) {
+    auto index = simConnectDataDefinition.getPhysicalIndex(kI);
+    switch (simConnectDataDefinition.getType(index)) {
       case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
-        outputSignals[kI]->set(0, std::any_cast<double>(simConnectData->get(kI)));
+        outputSignals[kI]->set(0, std::any_cast<double>(simConnectData->get(index)));
         break;
 
       default:
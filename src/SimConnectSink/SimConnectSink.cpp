@@ -16,6 +16,8 @@
 
 #include "SimConnectSink.h"
 
+#include <algorithm>
+#include <iostream>
 #include <BlockFactory/Core/Log.h>
 #include <BlockFactory/Core/Parameter.h>
 #include <BlockFactory/Core/Signal.h>
@@ -79,33 +81,42 @@ bool SimConnectSink::configureSizeAndPorts(
   // get output count
   try {
     auto variables = SimConnectVariableParser::getSimConnectVariablesFromParameterString(parameterVariables);
-    for (unsigned long long kI = 0; kI < variables.size(); ++kI) {
-      switch (SimConnectVariableLookupTable::getDataType(variables[kI])) {
-        case SIMCONNECT_VARIABLE_TYPE_BOOL:
-        case SIMCONNECT_VARIABLE_TYPE_INT32:
-        case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
-        case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
-          inputPortInfo.push_back(
-              {kI,
-               {1},
-               Port::DataType::DOUBLE});
-          break;
-
-        case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
-        case SIMCONNECT_VARIABLE_TYPE_XYZ:
-          inputPortInfo.push_back(
-              {
-                  kI,
-                  {3},
-                  Port::DataType::DOUBLE
-              }
-          );
-          break;
-
-        default:
-          break;
+    auto portSizes = SimConnectVariableParser::getPortSizesFromParameterString(parameterVariables);
+    for (const auto &unit : SimConnectVariableParser::getUnknownUnits(variables)) {
+      bfWarning << "Variable unit not known, it is passed to SimConnect without conversion: " << unit;
+    }
+    for (const auto &variable : variables) {
+      if (SimConnectVariableType::isString(SimConnectVariableLookupTable::getDataType(variable))) {
+        throw std::invalid_argument("String variables can not be written: " + variable.name.str());
+      }
+      if (variable.trigger != SIMCONNECT_VARIABLE_TRIGGER_NONE) {
+        throw std::invalid_argument("Triggers are only supported for reading: " + variable.name.str());
+      }
+      if (variable.isHold) {
+        throw std::invalid_argument("Hold is only supported for reading: " + variable.name.str());
+      }
+      if (variable.filter != SIMCONNECT_VARIABLE_FILTER_NONE) {
+        throw std::invalid_argument("Filters are only supported for reading: " + variable.name.str());
+      }
+      if (variable.isAdaptive) {
+        throw std::invalid_argument("Adaptive update rates are only supported for reading: " + variable.name.str());
       }
     }
+    size_t kVariable = 0;
+    for (unsigned long long kI = 0; kI < portSizes.size(); ++kI) {
+      // a vector port holds the elements of all variables of a range
+      int width = 0;
+      for (size_t kJ = 0; kJ < portSizes[kI]; ++kJ) {
+        width += getWidth(SimConnectVariableLookupTable::getDataType(variables[kVariable++]));
+      }
+      inputPortInfo.push_back(
+          {
+              kI,
+              {width},
+              Port::DataType::DOUBLE
+          }
+      );
+    }
   } catch (std::exception &ex) {
     bfError << "Failed to parse variables: " << ex.what();
     return false;
@@ -158,7 +169,31 @@ bool SimConnectSink::initialize(
     simConnectDataDefinition = SimConnectVariableParser::getSimConnectDataDefinitionFromVariables(simConnectVariables);
 
     // create data object
-    simConnectData = std::make_shared<SimConnectData>(simConnectDataDefinition);
+    simConnectData = std::make_shared<SimConnectData>(
+        simConnectDataDefinition,
+        SimConnectDataArena::get(connectionName)
+    );
+
+    // assign variables to ports, a vector port of adjacent 64-bit floating point variables is copied as one block
+    auto portSizes = SimConnectVariableParser::getPortSizesFromParameterString(parameterVariables);
+    inputMapping.clear();
+    inputPorts.clear();
+    for (size_t kI = 0; kI < portSizes.size(); ++kI) {
+      size_t first = inputMapping.size();
+      bool isContiguous = portSizes[kI] > 1;
+      size_t element = 0;
+      for (size_t kJ = 0; kJ < portSizes[kI]; ++kJ) {
+        size_t index = simConnectDataDefinition.getPhysicalIndex(first + kJ);
+        inputMapping.push_back({kI, element});
+        element += getWidth(simConnectDataDefinition.getType(index));
+        isContiguous = isContiguous
+            && !simConnectDataDefinition.isConverted(first + kJ)
+            && simConnectDataDefinition.getType(index) == SIMCONNECT_VARIABLE_TYPE_FLOAT64
+            && simConnectData->getGroupIndex(index)
+                == simConnectData->getGroupIndex(simConnectDataDefinition.getPhysicalIndex(first)) + kJ;
+      }
+      inputPorts.push_back({first, portSizes[kI], isContiguous});
+    }
 
   } catch (std::exception &ex) {
     bfError << "Failed to parse variables: " << ex.what();
@@ -177,63 +212,95 @@ bool SimConnectSink::initialize(
     return false;
   }
 
+  // duplicates are sent once, report how many variables are actually transferred
+  std::cout << "SimConnectSink ('" << connectionName << "'): " << simConnectDataDefinition.size() << " of ";
+  std::cout << simConnectDataDefinition.getLogicalSize() << " variables sent" << std::endl;
+
+  // buffers of all blocks of the connection share one arena, report how many heap allocations back them
+  auto arena = SimConnectDataArena::get(connectionName);
+  std::cout << "SimConnectSink ('" << connectionName << "'): " << arena->getBufferCount() << " buffers in ";
+  std::cout << arena->getAllocationCount() << " arena allocations" << std::endl;
+
   return true;
 }
 
 bool SimConnectSink::output(
     const BlockInformation *blockInfo
 ) {
-  // vector for output signals
+  // vector for input signals
   std::vector<InputSignalPtr> inputSignals;
-  for (int kI = 0; kI < simConnectDataDefinition.size(); ++kI) {
-    // get output signal
-    auto outputSignal = blockInfo->getInputPortSignal(kI);
-    // check if output is ok
-    if (!outputSignal) {
+  for (int kI = 0; kI < inputPorts.size(); ++kI) {
+    // get input signal
+    auto inputSignal = blockInfo->getInputPortSignal(kI);
+    // check if input is ok
+    if (!inputSignal) {
       bfError << "Signals not valid";
       return false;
     }
     // store signal
-    inputSignals.emplace_back(outputSignal);
+    inputSignals.emplace_back(inputSignal);
   }
 
-  // write output value to all signals
-  for (int kI = 0; kI < inputSignals.size(); ++kI) {
-    switch (simConnectDataDefinition.getType(kI)) {
+  // vector ports of adjacent variables are copied as one block
+  for (const auto &port : inputPorts) {
+    if (port.isContiguous) {
+      auto group = simConnectData->getGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT64>();
+      const auto *buffer = inputSignals[inputMapping[port.firstMapping].port]->getBuffer<double>();
+      std::copy(
+          buffer,
+          buffer + port.mappingCount,
+          group.data() + simConnectData->getGroupIndex(simConnectDataDefinition.getPhysicalIndex(port.firstMapping))
+      );
+    }
+  }
+
+  // write input value of all other signals
+  for (size_t kI = 0; kI < inputMapping.size(); ++kI) {
+    const auto &signal = inputSignals[inputMapping[kI].port];
+    auto element = inputMapping[kI].element;
+    if (inputPorts[inputMapping[kI].port].isContiguous) {
+      continue;
+    }
+
+    // duplicates write to the same physical variable, other units are converted back
+    auto index = simConnectDataDefinition.getPhysicalIndex(kI);
+    switch (simConnectDataDefinition.getType(index)) {
       case SIMCONNECT_VARIABLE_TYPE_BOOL:
-        simConnectData->set(kI, static_cast<bool>(inputSignals[kI]->get<double>(0) != 0));
+        simConnectData->set(index, static_cast<bool>(signal->get<double>(element) != 0));
         break;
 
       case SIMCONNECT_VARIABLE_TYPE_INT32:
-        simConnectData->set(kI, static_cast<long>(inputSignals[kI]->get<double>(0)));
+        simConnectData->set(index, static_cast<long>(signal->get<double>(element)));
         break;
 
       case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
-        simConnectData->set(kI, static_cast<float>(inputSignals[kI]->get<double>(0)));
+        simConnectData->set(index, static_cast<float>(signal->get<double>(element)));
         break;
 
-      case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
-        simConnectData->set(kI, inputSignals[kI]->get<double>(0));
+      case SIMCONNECT_VARIABLE_TYPE_FLOAT64: {
+        const auto &conversion = simConnectDataDefinition.getConversion(kI);
+        simConnectData->set(index, (signal->get<double>(element) - conversion.offset) / conversion.scale);
         break;
+      }
 
       case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
         simConnectData->set(
-            kI,
+            index,
             SIMCONNECT_DATA_LATLONALT{
-                inputSignals[kI]->get<double>(0),
-                inputSignals[kI]->get<double>(1),
-                inputSignals[kI]->get<double>(2)
+                signal->get<double>(element),
+                signal->get<double>(element + 1),
+                signal->get<double>(element + 2)
             }
         );
         break;
 
       case SIMCONNECT_VARIABLE_TYPE_XYZ:
         simConnectData->set(
-            kI,
+            index,
             SIMCONNECT_DATA_XYZ{
-                inputSignals[kI]->get<double>(0),
-                inputSignals[kI]->get<double>(1),
-                inputSignals[kI]->get<double>(2)
+                signal->get<double>(element),
+                signal->get<double>(element + 1),
+                signal->get<double>(element + 2)
             }
         );
         break;
@@ -265,3 +332,16 @@ bool SimConnectSink::terminate(
   // success
   return true;
 }
+
+int SimConnectSink::getWidth(
+    SIMCONNECT_VARIABLE_TYPE type
+) {
+  switch (type) {
+    case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
+    case SIMCONNECT_VARIABLE_TYPE_XYZ:
+      return 3;
+
+    default:
+      return 1;
+  }
+}
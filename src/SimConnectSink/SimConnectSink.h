@@ -59,9 +59,26 @@ class simconnect::toolbox::blocks::SimConnectSink : public blockfactory::core::B
   ) override;
 
  private:
+  struct InputMapping {
+    size_t port = 0;
+    size_t element = 0;
+  };
+
+  struct InputPort {
+    size_t firstMapping = 0;
+    size_t mappingCount = 0;
+    bool isContiguous = false;
+  };
+
   int configurationIndex = 0;
   std::string connectionName;
   std::shared_ptr<simconnect::toolbox::connection::SimConnectData> simConnectData;
   simconnect::toolbox::connection::SimConnectDataDefinition simConnectDataDefinition;
   simconnect::toolbox::connection::SimConnectDataInterface simConnectInterface;
+  std::vector<InputMapping> inputMapping;
+  std::vector<InputPort> inputPorts;
+
+  static int getWidth(
+      simconnect::toolbox::connection::SIMCONNECT_VARIABLE_TYPE type
+  );
 };
@@ -19,6 +19,9 @@
 #include <BlockFactory/Core/Log.h>
 #include <BlockFactory/Core/Parameter.h>
 #include <BlockFactory/Core/Signal.h>
+#include <cmath>
+#include <iostream>
+#include <map>
 #include <SimConnectVariableParser.h>
 
 using namespace blockfactory::core;
@@ -79,35 +82,24 @@ bool SimConnectSource::configureSizeAndPorts(
   // get output count
   try {
     auto variables = SimConnectVariableParser::getSimConnectVariablesFromParameterString(parameterVariables);
-    for (unsigned long long kI = 0; kI < variables.size(); ++kI) {
-      switch (SimConnectVariableLookupTable::getDataType(variables[kI])) {
-        case SIMCONNECT_VARIABLE_TYPE_BOOL:
-        case SIMCONNECT_VARIABLE_TYPE_INT32:
-        case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
-        case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
-          outputPortInfo.push_back(
-              {
-                  kI,
-                  {1},
-                  Port::DataType::DOUBLE
-              }
-          );
-          break;
-
-        case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
-        case SIMCONNECT_VARIABLE_TYPE_XYZ:
-          outputPortInfo.push_back(
-              {
-                  kI,
-                  {3},
-                  Port::DataType::DOUBLE
-              }
-          );
-          break;
-
-        default:
-          break;
+    auto portSizes = SimConnectVariableParser::getPortSizesFromParameterString(parameterVariables);
+    for (const auto &unit : SimConnectVariableParser::getUnknownUnits(variables)) {
+      bfWarning << "Variable unit not known, it is passed to SimConnect without conversion: " << unit;
+    }
+    size_t kVariable = 0;
+    for (unsigned long long kI = 0; kI < portSizes.size(); ++kI) {
+      // a vector port holds the elements of all variables of a range
+      int width = 0;
+      for (size_t kJ = 0; kJ < portSizes[kI]; ++kJ) {
+        width += getWidth(variables[kVariable++]);
       }
+      outputPortInfo.push_back(
+          {
+              kI,
+              {width},
+              Port::DataType::DOUBLE
+          }
+      );
     }
   } catch (std::exception &ex) {
     bfError << "Failed to parse variables: " << ex.what();
@@ -156,30 +148,219 @@ bool SimConnectSource::initialize(
     return false;
   }
   try {
-    // parse variables and get data definition
+    // parse variables
     auto simConnectVariables = SimConnectVariableParser::getSimConnectVariablesFromParameterString(parameterVariables);
-    simConnectDataDefinition = SimConnectVariableParser::getSimConnectDataDefinitionFromVariables(simConnectVariables);
 
-    // create data object
-    simConnectData = std::make_shared<SimConnectData>(simConnectDataDefinition);
+    // every priority of variables read every step gets its own lane, ordered from highest to lowest priority
+    std::map<SIMCONNECT_VARIABLE_PRIORITY, size_t> laneIndex;
+    for (const auto &variable : simConnectVariables) {
+      if (SimConnectSystemEvent::getState(variable.name) == SIMCONNECT_SYSTEM_STATE_INVALID
+          && variable.name != SimConnectSharedConnection::MISMATCH_COUNT_VARIABLE
+          && variable.name != SimConnectSharedConnection::UNCHANGED_VARIABLE
+          && variable.name != SimConnectUpdateRateScheduler::REQUESTED_SIZE_VARIABLE
+          && !SimConnectVariableLookupTable::isStatic(variable)) {
+        laneIndex[variable.priority] = 0;
+      }
+    }
+    if (laneIndex.empty()) {
+      // static variables and system state need a connection as well
+      laneIndex[SIMCONNECT_VARIABLE_PRIORITY_NORMAL] = 0;
+    }
+    lanes.clear();
+    for (auto &[priority, index] : laneIndex) {
+      index = lanes.size();
+      auto &lane = lanes.emplace_back();
+      lane.priority = priority;
+      lane.connection = SimConnectSharedConnection::get(connectionName, priority);
+      lane.participant = lane.connection->join();
+    }
+
+    // split variables into the connections of the lanes, static variables are read once by the lowest priority lane
+    auto &staticConnection = *lanes.back().connection;
+    outputMapping.clear();
+    hasSystemState = false;
+    for (const auto &variable : simConnectVariables) {
+      auto systemState = SimConnectSystemEvent::getState(variable.name);
+      if (systemState != SIMCONNECT_SYSTEM_STATE_INVALID) {
+        outputMapping.push_back({false, 0, 0, systemState});
+        hasSystemState = true;
+      } else if (variable.name == SimConnectSharedConnection::MISMATCH_COUNT_VARIABLE) {
+        outputMapping.push_back({false, 0, 0, SIMCONNECT_SYSTEM_STATE_INVALID, true});
+      } else if (variable.name == SimConnectSharedConnection::UNCHANGED_VARIABLE) {
+        outputMapping.push_back({});
+        outputMapping.back().isFrameUnchanged = true;
+      } else if (variable.name == SimConnectUpdateRateScheduler::REQUESTED_SIZE_VARIABLE) {
+        outputMapping.push_back({});
+        outputMapping.back().isRequestedSize = true;
+      } else if (SimConnectVariableLookupTable::isStatic(variable)) {
+        outputMapping.push_back({true, 0, staticConnection.addStatic(variable)});
+      } else {
+        auto lane = laneIndex[variable.priority];
+        outputMapping.push_back({false, lane, lanes[lane].connection->add(variable)});
+      }
+      outputMapping.back().isHold = variable.isHold;
+    }
+
+    // assign variables to ports, a vector port holds all variables of a range
+    auto portSizes = SimConnectVariableParser::getPortSizesFromParameterString(parameterVariables);
+    outputPorts.clear();
+    size_t kMapping = 0;
+    for (size_t kI = 0; kI < portSizes.size(); ++kI) {
+      outputPorts.push_back({kMapping, portSizes[kI]});
+      size_t element = 0;
+      for (size_t kJ = 0; kJ < portSizes[kI]; ++kJ, ++kMapping) {
+        outputMapping[kMapping].port = kI;
+        outputMapping[kMapping].element = element;
+        element += getWidth(simConnectVariables[kMapping]);
+      }
+    }
+
+    // filters advance with the simulation time of the frames of their lane
+    for (size_t kI = 0; kI < simConnectVariables.size(); ++kI) {
+      auto &lane = lanes[outputMapping[kI].lane];
+      if (simConnectVariables[kI].filter != SIMCONNECT_VARIABLE_FILTER_NONE
+          && !outputMapping[kI].isStatic
+          && !lane.hasFrameTime) {
+        lane.frameTimeIndex = lane.connection->add(
+            SimConnectVariable(SimConnectSharedConnection::FRAME_TIME_VARIABLE, SimConnectSharedConnection::FRAME_TIME_UNIT)
+        );
+        lane.hasFrameTime = true;
+      }
+    }
+
+    // connect to FS, blocks of the same connection and priority share one connection that reads one frame per step
+    for (auto &lane : lanes) {
+      bool connected = lane.connection->connect(
+          configurationIndex,
+          lane.priority == SIMCONNECT_VARIABLE_PRIORITY_NORMAL
+          ? connectionName
+          : connectionName + " (" + getLaneName(lane.priority) + ")"
+      );
+      if (!connected) {
+        bfError << "Failed to connect to SimConnect";
+        return false;
+      }
+
+      // the variables of this block keep their indices when later blocks add theirs
+      lane.dataDefinition = lane.connection->getDataDefinition();
+      lane.data = lane.connection->getData();
+      if (lane.hasFrameTime) {
+        lane.frameTimeIndex = lane.dataDefinition.getPhysicalIndex(lane.frameTimeIndex);
+      }
+    }
+    simConnectStaticDataDefinition = staticConnection.getStaticDataDefinition();
+    simConnectStaticData = staticConnection.getStaticData();
+
+    // duplicates share the physical variable, other units are converted as one batch on the 64-bit floating point group
+    staticConverter.clear();
+    staticObserver.clear();
+    for (auto &mapping : outputMapping) {
+      if (mapping.isFrameMismatchCount
+          || mapping.isFrameUnchanged
+          || mapping.isRequestedSize
+          || mapping.systemState != SIMCONNECT_SYSTEM_STATE_INVALID) {
+        continue;
+      }
+      auto &dataDefinition = mapping.isStatic ? simConnectStaticDataDefinition : lanes[mapping.lane].dataDefinition;
+      auto &data = mapping.isStatic ? *simConnectStaticData : *lanes[mapping.lane].data;
+      auto &converter = mapping.isStatic ? staticConverter : lanes[mapping.lane].converter;
+      auto logicalIndex = mapping.index;
+      mapping.index = dataDefinition.getPhysicalIndex(logicalIndex);
+      if (dataDefinition.isConverted(logicalIndex)) {
+        mapping.isConverted = true;
+        mapping.conversion = converter.add(data.getGroupIndex(mapping.index), dataDefinition.getConversion(logicalIndex));
+      }
+      if (SimConnectVariableType::isString(dataDefinition.getType(mapping.index))) {
+        mapping.stringHash = data.getStringHash(mapping.index);
+      }
+
+      // triggers are evaluated on the physical variable, the threshold is given in the unit of the variable
+      const auto &variable = dataDefinition.getLogical(logicalIndex);
+      if (variable.trigger != SIMCONNECT_VARIABLE_TRIGGER_NONE) {
+        auto &observer = mapping.isStatic ? staticObserver : lanes[mapping.lane].observer;
+        auto conversion = dataDefinition.getConversion(logicalIndex);
+        double threshold = variable.trigger == SIMCONNECT_VARIABLE_TRIGGER_DEADBAND
+            ? variable.triggerThreshold / std::abs(conversion.scale)
+            : (variable.triggerThreshold - conversion.offset) / conversion.scale;
+        mapping.isTrigger = true;
+        mapping.trigger = observer.add(dataDefinition, mapping.index, variable.trigger, threshold);
+        mapping.isHold = false;
+      }
+
+      // filters run on the 64-bit floating point group and convert into the unit of the variable themselves
+      if (variable.filter != SIMCONNECT_VARIABLE_FILTER_NONE) {
+        if (mapping.isStatic) {
+          throw std::invalid_argument("Filters are not supported for static variables: " + variable.name.str());
+        }
+        if (dataDefinition.getType(mapping.index) != SIMCONNECT_VARIABLE_TYPE_FLOAT64) {
+          throw std::invalid_argument("Filters are only supported for FLOAT64 variables: " + variable.name.str());
+        }
+        if (mapping.isTrigger) {
+          throw std::invalid_argument("Filters can not be combined with triggers: " + variable.name.str());
+        }
+        mapping.isFiltered = true;
+        mapping.filter = lanes[mapping.lane].filter.add(
+            data.getGroupIndex(mapping.index),
+            dataDefinition.getConversion(logicalIndex),
+            variable.filter,
+            variable.filterParameter
+        );
+      }
+    }
+    for (auto &lane : lanes) {
+      lane.converted.assign(lane.converter.size(), 0.0);
+      lane.filtered.assign(lane.filter.size(), 0.0);
+    }
+    staticConverted.assign(staticConverter.size(), 0.0);
+
+    // vector ports of adjacent 64-bit floating point variables are copied as one block
+    for (auto &port : outputPorts) {
+      const auto &first = outputMapping[port.firstMapping];
+      port.isHold = first.isHold;
+      port.isContiguous = port.mappingCount > 1;
+      for (size_t kI = 0; kI < port.mappingCount && port.isContiguous; ++kI) {
+        const auto &mapping = outputMapping[port.firstMapping + kI];
+        port.isContiguous = !mapping.isStatic
+            && !mapping.isFrameMismatchCount
+            && !mapping.isFrameUnchanged
+            && !mapping.isRequestedSize
+            && !mapping.isConverted
+            && !mapping.isTrigger
+            && !mapping.isFiltered
+            && mapping.systemState == SIMCONNECT_SYSTEM_STATE_INVALID
+            && mapping.lane == first.lane
+            && lanes[mapping.lane].dataDefinition.getType(mapping.index) == SIMCONNECT_VARIABLE_TYPE_FLOAT64
+            && lanes[mapping.lane].data->getGroupIndex(mapping.index)
+                == lanes[first.lane].data->getGroupIndex(first.index) + kI;
+      }
+    }
 
   } catch (std::exception &ex) {
     bfError << "Failed to parse variables: " << ex.what();
     return false;
   }
 
-  // connect to FS
-  bool connected = simConnectInterface.connect(
-      configurationIndex,
-      connectionName,
-      simConnectDataDefinition,
-      simConnectData
-  );
-  if (!connected) {
-    bfError << "Failed to connect to SimConnect";
+  // system state is derived from system events of the highest priority lane
+  if (hasSystemState && !lanes.front().connection->getDataInterface()->subscribeToSystemState()) {
+    bfError << "Failed to subscribe to the system state";
     return false;
   }
 
+  // duplicates are requested once, report how many variables all blocks of the connection actually transfer
+  size_t physicalSize = simConnectStaticDataDefinition.size();
+  size_t logicalSize = simConnectStaticDataDefinition.getLogicalSize();
+  for (const auto &lane : lanes) {
+    physicalSize += lane.dataDefinition.size();
+    logicalSize += lane.dataDefinition.getLogicalSize();
+  }
+  std::cout << "SimConnectSource ('" << connectionName << "'): " << physicalSize << " of " << logicalSize;
+  std::cout << " variables requested" << std::endl;
+
+  // buffers of all blocks of the connection share one arena, report how many heap allocations back them
+  auto arena = SimConnectDataArena::get(connectionName);
+  std::cout << "SimConnectSource ('" << connectionName << "'): " << arena->getBufferCount() << " buffers in ";
+  std::cout << arena->getAllocationCount() << " arena allocations" << std::endl;
+
   return true;
 }
 
@@ -188,7 +369,7 @@ bool SimConnectSource::output(
 ) {
   // vector for output signals
   std::vector<OutputSignalPtr> outputSignals;
-  for (int kI = 0; kI < simConnectDataDefinition.size(); ++kI) {
+  for (int kI = 0; kI < outputPorts.size(); ++kI) {
     // get output signal
     auto outputSignal = blockInfo->getOutputPortSignal(kI);
     // check if output is ok
@@ -200,45 +381,185 @@ bool SimConnectSource::output(
     outputSignals.emplace_back(outputSignal);
   }
 
-  // get data from simconnect
-  if (!simConnectInterface.requestData()) {
-    bfError << "Failed to request data from SimConnect";
-    return false;
+  // get data from simconnect, the first block of a step reads the frame that all blocks of the connection use
+  for (auto &lane : lanes) {
+    if (!lane.connection->update(lane.participant)) {
+      bfError << "Failed to read data from SimConnect";
+      return false;
+    }
+    lane.data = lane.connection->getData();
   }
-  if (!simConnectInterface.readData()) {
-    bfError << "Failed to read data from SimConnect";
-    return false;
+  simConnectStaticData = lanes.back().connection->getStaticData();
+
+  // the frame is unchanged when no data object received content different to the one of the previous step
+  bool isFrameUnchanged = hasOutput && simConnectStaticData->getContentHash() == staticContentHash;
+  staticContentHash = simConnectStaticData->getContentHash();
+  for (auto &lane : lanes) {
+    isFrameUnchanged &= lane.data->getContentHash() == lane.contentHash;
+    lane.contentHash = lane.data->getContentHash();
+  }
+  hasOutput = true;
+
+  // convert values requested in another unit, converted values of an unchanged frame are still valid
+  for (auto &lane : lanes) {
+    if (lane.converter.size() > 0 && !isFrameUnchanged) {
+      lane.converter.convert(
+          lane.data->getGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT64>().data(),
+          lane.converted.data()
+      );
+    }
+  }
+  if (staticConverter.size() > 0 && !isFrameUnchanged) {
+    staticConverter.convert(
+        simConnectStaticData->getGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT64>().data(),
+        staticConverted.data()
+    );
+  }
+
+  // filters advance with every new frame of their lane by the simulation time passed since its previous one
+  for (auto &lane : lanes) {
+    auto frameCount = lane.connection->getDataInterface()->getFrameCount();
+    if (lane.filter.size() > 0 && frameCount > 0 && frameCount != lane.filterFrameCount) {
+      auto frameTime = std::any_cast<double>(lane.data->get(lane.frameTimeIndex));
+      lane.filter.process(
+          lane.data->getGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT64>().data(),
+          lane.filtered.data(),
+          frameTime - lane.filterFrameTime
+      );
+      lane.filterFrameCount = frameCount;
+      lane.filterFrameTime = frameTime;
+    }
   }
 
-  // write output value to all signals
-  for (int kI = 0; kI < outputSignals.size(); ++kI) {
-    switch (simConnectDataDefinition.getType(kI)) {
+  // evaluate triggers of all variables in one pass per data object
+  for (auto &lane : lanes) {
+    if (lane.observer.size() > 0) {
+      lane.observer.evaluate(*lane.data);
+    }
+  }
+  if (staticObserver.size() > 0) {
+    staticObserver.evaluate(*simConnectStaticData);
+  }
+
+  // vector ports of adjacent variables are copied as one block
+  for (const auto &port : outputPorts) {
+    if (port.isContiguous && !(port.isHold && isFrameUnchanged)) {
+      const auto &first = outputMapping[port.firstMapping];
+      auto group = lanes[first.lane].data->getGroup<SIMCONNECT_VARIABLE_TYPE_FLOAT64>();
+      outputSignals[first.port]->setBuffer(
+          group.data() + lanes[first.lane].data->getGroupIndex(first.index),
+          port.mappingCount
+      );
+    }
+  }
+
+  // write output value to all other signals
+  for (auto &mapping : outputMapping) {
+    auto &signal = outputSignals[mapping.port];
+    auto element = mapping.element;
+    if (outputPorts[mapping.port].isContiguous) {
+      continue;
+    }
+
+    // frame mismatch count, all blocks of a connection read the same frame
+    if (mapping.isFrameMismatchCount) {
+      signal->set(element, 0.0);
+      continue;
+    }
+
+    // frame unchanged
+    if (mapping.isFrameUnchanged) {
+      signal->set(element, isFrameUnchanged ? 1.0 : 0.0);
+      continue;
+    }
+
+    // bytes requested by all lanes in this step
+    if (mapping.isRequestedSize) {
+      size_t requestedSize = 0;
+      for (const auto &lane : lanes) {
+        requestedSize += lane.connection->getDataInterface()->getRequestedSize();
+      }
+      signal->set(element, static_cast<double>(requestedSize));
+      continue;
+    }
+
+    // system state
+    if (mapping.systemState != SIMCONNECT_SYSTEM_STATE_INVALID) {
+      signal->set(
+          element,
+          SimConnectSystemEvent::getValue(
+              mapping.systemState,
+              lanes.front().connection->getDataInterface()->getSystemState()
+          )
+      );
+      continue;
+    }
+
+    // triggers are 1 in steps in which they fired
+    if (mapping.isTrigger) {
+      auto &observer = mapping.isStatic ? staticObserver : lanes[mapping.lane].observer;
+      signal->set(element, observer.isFired(mapping.trigger) ? 1.0 : 0.0);
+      continue;
+    }
+
+    // values of an unchanged frame are already in the signal
+    if (mapping.isHold && isFrameUnchanged) {
+      continue;
+    }
+
+    // get data holding the value
+    auto &lane = lanes[mapping.lane];
+    if (mapping.isFiltered) {
+      signal->set(element, lane.filtered[mapping.filter]);
+      continue;
+    }
+    if (mapping.isConverted) {
+      signal->set(element, mapping.isStatic ? staticConverted[mapping.conversion] : lane.converted[mapping.conversion]);
+      continue;
+    }
+
+    auto &dataDefinition = mapping.isStatic ? simConnectStaticDataDefinition : lane.dataDefinition;
+    auto &data = mapping.isStatic ? *simConnectStaticData : *lane.data;
+    auto index = mapping.index;
+
+    switch (dataDefinition.getType(index)) {
       case SIMCONNECT_VARIABLE_TYPE_BOOL:
-        outputSignals[kI]->set(0, std::any_cast<bool>(simConnectData->get(kI)) ? 1.0 : 0.0);
+        signal->set(element, std::any_cast<bool>(data.get(index)) ? 1.0 : 0.0);
         break;
 
       case SIMCONNECT_VARIABLE_TYPE_INT32:
-        outputSignals[kI]->set(0, static_cast<double>(std::any_cast<long>(simConnectData->get(kI))));
+        signal->set(element, static_cast<double>(std::any_cast<long>(data.get(index))));
         break;
 
       case SIMCONNECT_VARIABLE_TYPE_FLOAT32:
-        outputSignals[kI]->set(0, static_cast<double>(std::any_cast<float>(simConnectData->get(kI))));
+        signal->set(element, static_cast<double>(std::any_cast<float>(data.get(index))));
         break;
 
       case SIMCONNECT_VARIABLE_TYPE_FLOAT64:
-        outputSignals[kI]->set(0, std::any_cast<double>(simConnectData->get(kI)));
+        signal->set(element, std::any_cast<double>(data.get(index)));
         break;
 
       case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
-        outputSignals[kI]->set(0, std::any_cast<SIMCONNECT_DATA_LATLONALT>(simConnectData->get(kI)).Latitude);
-        outputSignals[kI]->set(1, std::any_cast<SIMCONNECT_DATA_LATLONALT>(simConnectData->get(kI)).Longitude);
-        outputSignals[kI]->set(2, std::any_cast<SIMCONNECT_DATA_LATLONALT>(simConnectData->get(kI)).Altitude);
+        signal->set(element, std::any_cast<SIMCONNECT_DATA_LATLONALT>(data.get(index)).Latitude);
+        signal->set(element + 1, std::any_cast<SIMCONNECT_DATA_LATLONALT>(data.get(index)).Longitude);
+        signal->set(element + 2, std::any_cast<SIMCONNECT_DATA_LATLONALT>(data.get(index)).Altitude);
         break;
 
       case SIMCONNECT_VARIABLE_TYPE_XYZ:
-        outputSignals[kI]->set(0, std::any_cast<SIMCONNECT_DATA_XYZ>(simConnectData->get(kI)).x);
-        outputSignals[kI]->set(1, std::any_cast<SIMCONNECT_DATA_XYZ>(simConnectData->get(kI)).y);
-        outputSignals[kI]->set(2, std::any_cast<SIMCONNECT_DATA_XYZ>(simConnectData->get(kI)).z);
+        signal->set(element, std::any_cast<SIMCONNECT_DATA_XYZ>(data.get(index)).x);
+        signal->set(element + 1, std::any_cast<SIMCONNECT_DATA_XYZ>(data.get(index)).y);
+        signal->set(element + 2, std::any_cast<SIMCONNECT_DATA_XYZ>(data.get(index)).z);
+        break;
+
+      case SIMCONNECT_VARIABLE_TYPE_STRING8:
+      case SIMCONNECT_VARIABLE_TYPE_STRING32:
+      case SIMCONNECT_VARIABLE_TYPE_STRING64:
+      case SIMCONNECT_VARIABLE_TYPE_STRING256:
+        // strings are output as the number of changes, detected by comparing the hash of the slot
+        if (data.hasStringChanged(index, mapping.stringHash)) {
+          mapping.stringChangeCount++;
+        }
+        signal->set(element, mapping.stringChangeCount);
         break;
 
       default:
@@ -253,12 +574,55 @@ bool SimConnectSource::output(
 bool SimConnectSource::terminate(
     const BlockInformation *blockInfo
 ) {
-  // disconnect
-  simConnectInterface.disconnect();
-
-  // reset simconnect data
-  simConnectData.reset();
+  // leave the shared connections, the last block closes them
+  for (auto &lane : lanes) {
+    lane.connection->leave(lane.participant);
+  }
+  lanes.clear();
+  simConnectStaticData.reset();
+  hasOutput = false;
 
   // success
   return true;
 }
+
+std::string SimConnectSource::getLaneName(
+    SIMCONNECT_VARIABLE_PRIORITY priority
+) {
+  switch (priority) {
+    case SIMCONNECT_VARIABLE_PRIORITY_HIGH:
+      return "HIGH";
+    case SIMCONNECT_VARIABLE_PRIORITY_NORMAL:
+      return "NORMAL";
+    case SIMCONNECT_VARIABLE_PRIORITY_LOW:
+      return "LOW";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+int SimConnectSource::getWidth(
+    const SimConnectVariable &variable
+) {
+  // system state, frame mismatch count, frame unchanged and requested bytes are scalars
+  if (SimConnectSystemEvent::getState(variable.name) != SIMCONNECT_SYSTEM_STATE_INVALID
+      || variable.name == SimConnectSharedConnection::MISMATCH_COUNT_VARIABLE
+      || variable.name == SimConnectSharedConnection::UNCHANGED_VARIABLE
+      || variable.name == SimConnectUpdateRateScheduler::REQUESTED_SIZE_VARIABLE) {
+    return 1;
+  }
+
+  // triggers are scalars
+  if (variable.trigger != SIMCONNECT_VARIABLE_TRIGGER_NONE) {
+    return 1;
+  }
+
+  switch (SimConnectVariableLookupTable::getDataType(variable)) {
+    case SIMCONNECT_VARIABLE_TYPE_LATLONALT:
+    case SIMCONNECT_VARIABLE_TYPE_XYZ:
+      return 3;
+
+    default:
+      return 1;
+  }
+}
@@ -20,8 +20,12 @@
 #include <BlockFactory/Core/BlockInformation.h>
 #include <SimConnectData.h>
 #include <SimConnectDataDefinition.h>
+#include <SimConnectDataFilter.h>
+#include <SimConnectDataObserver.h>
 #include <SimConnectVariable.h>
-#include <SimConnectDataInterface.h>
+#include <SimConnectSharedConnection.h>
+#include <SimConnectSystemEvent.h>
+#include <SimConnectUnitConverter.h>
 #include <SimConnectVariableLookupTable.h>
 
 namespace simconnect::toolbox::blocks {
@@ -59,9 +63,73 @@ class simconnect::toolbox::blocks::SimConnectSource : public blockfactory::core:
   ) override;
 
  private:
+  struct Lane {
+    simconnect::toolbox::connection::SIMCONNECT_VARIABLE_PRIORITY priority =
+        simconnect::toolbox::connection::SIMCONNECT_VARIABLE_PRIORITY_NORMAL;
+    simconnect::toolbox::connection::SimConnectDataDefinition dataDefinition;
+    std::shared_ptr<simconnect::toolbox::connection::SimConnectData> data;
+    std::shared_ptr<simconnect::toolbox::connection::SimConnectSharedConnection> connection;
+    size_t participant = 0;
+    simconnect::toolbox::connection::SimConnectUnitConverter converter;
+    std::vector<double> converted;
+    simconnect::toolbox::connection::SimConnectDataObserver observer;
+    uint64_t contentHash = 0;
+    simconnect::toolbox::connection::SimConnectDataFilter filter;
+    std::vector<double> filtered;
+    bool hasFrameTime = false;
+    size_t frameTimeIndex = 0;
+    unsigned long long filterFrameCount = 0;
+    double filterFrameTime = 0;
+  };
+
+  struct OutputMapping {
+    bool isStatic = false;
+    size_t lane = 0;
+    size_t index = 0;
+    simconnect::toolbox::connection::SIMCONNECT_SYSTEM_STATE systemState =
+        simconnect::toolbox::connection::SIMCONNECT_SYSTEM_STATE_INVALID;
+    bool isFrameMismatchCount = false;
+    size_t port = 0;
+    size_t element = 0;
+    bool isConverted = false;
+    size_t conversion = 0;
+    uint64_t stringHash = 0;
+    double stringChangeCount = 0;
+    bool isTrigger = false;
+    size_t trigger = 0;
+    bool isFrameUnchanged = false;
+    bool isRequestedSize = false;
+    bool isHold = false;
+    bool isFiltered = false;
+    size_t filter = 0;
+  };
+
+  struct OutputPort {
+    size_t firstMapping = 0;
+    size_t mappingCount = 0;
+    bool isContiguous = false;
+    bool isHold = false;
+  };
+
   int configurationIndex = 0;
   std::string connectionName;
-  std::shared_ptr<simconnect::toolbox::connection::SimConnectData> simConnectData;
-  simconnect::toolbox::connection::SimConnectDataDefinition simConnectDataDefinition;
-  simconnect::toolbox::connection::SimConnectDataInterface simConnectInterface;
+  std::vector<Lane> lanes;
+  std::shared_ptr<simconnect::toolbox::connection::SimConnectData> simConnectStaticData;
+  simconnect::toolbox::connection::SimConnectDataDefinition simConnectStaticDataDefinition;
+  simconnect::toolbox::connection::SimConnectUnitConverter staticConverter;
+  std::vector<double> staticConverted;
+  simconnect::toolbox::connection::SimConnectDataObserver staticObserver;
+  std::vector<OutputMapping> outputMapping;
+  std::vector<OutputPort> outputPorts;
+  bool hasSystemState = false;
+  uint64_t staticContentHash = 0;
+  bool hasOutput = false;
+
+  static std::string getLaneName(
+      simconnect::toolbox::connection::SIMCONNECT_VARIABLE_PRIORITY priority
+  );
+
+  static int getWidth(
+      const simconnect::toolbox::connection::SimConnectVariable &variable
+  );
 };